@@ -0,0 +1,754 @@
+#ifndef DEQUE_HPP
+# define DEQUE_HPP
+
+# include "includes/containers.hpp"
+# include "includes/is_integral.hpp"
+
+// segmented double ended queue:
+// 1. elements live in fixed size blocks that are never reallocated,
+//    an element never moves once constructed (except for insert/erase in the middle)
+// 2. a map (array of block pointers) gives the block of each position,
+//    growing the map only copies block pointers
+// 3. push and pop at either end are O(1): at worst one block is allocated or released,
+//    and when the map is full it is recentered or doubled, which copies size / block_size pointers
+//    an emptied block is kept as a spare for the next push at its end, one per end
+// 4. positions are counted from the start of the map: element i sits at position _start + i,
+//    in block (_start + i) / block_size
+
+namespace ft
+{
+
+template <class T, class Alloc = std::allocator<T> >
+class deque {
+public:
+
+	////////////////
+	// Block size //
+	////////////////
+
+	// number of elements per block: 4KB blocks, and never less than 16 elements per block.
+	static const std::size_t	block_size = (sizeof(T) < 256) ? 4096 / sizeof(T) : 16;
+
+	///////////////////////
+	// Iterator subclass //
+	///////////////////////
+
+	template <bool IsConst>
+	class dequeIterator {
+	public:
+		// Member types
+		typedef typename		ft::conditional<IsConst, const T, T>::type			value_type;
+		typedef					std::ptrdiff_t										difference_type;
+		typedef					std::size_t											size_type;
+		typedef					value_type *										pointer;
+		typedef					value_type &										reference;
+		typedef					ft::random_access_iterator_tag						iterator_category;
+		// -structors
+		dequeIterator			(void)												{ _cur = NULL; _first = NULL; _node = NULL; }
+		dequeIterator			(T ** node, T * cur)								{ _node = node; _first = *node; _cur = cur; }
+		dequeIterator			(const dequeIterator & x)							{ *this = x; }
+		~dequeIterator			(void)												{}
+		// Const stuff
+		template <bool B>		dequeIterator
+			(const dequeIterator<B> & x, typename ft::enable_if<!B>::type* = 0)		{ _node = x.getNode(); _first = *_node; _cur = x.getPtr(); }
+
+		// Assignment
+		dequeIterator &			operator=	(const dequeIterator & x)				{ _node = x._node; _first = x._first; _cur = x._cur; return (*this); }
+		dequeIterator &			operator+=	(difference_type n)						{ this->move(n); return (*this); }
+		dequeIterator &			operator-=	(difference_type n)						{ this->move(-n); return (*this); }
+		// Comparison
+		template <bool B> bool	operator==	(const dequeIterator<B> & x) const		{ return (_node == x.getNode() && _cur == x.getPtr()); }
+		template <bool B> bool	operator!=	(const dequeIterator<B> & x) const		{ return (!(*this == x)); }
+		template <bool B> bool	operator<	(const dequeIterator<B> & x) const		{ return (*this - x < 0); }
+		template <bool B> bool	operator>	(const dequeIterator<B> & x) const		{ return (*this - x > 0); }
+		template <bool B> bool	operator<=	(const dequeIterator<B> & x) const		{ return (*this - x <= 0); }
+		template <bool B> bool	operator>=	(const dequeIterator<B> & x) const		{ return (*this - x >= 0); }
+		// -crementation
+		dequeIterator &			operator++	(void)									{ this->next(); return (*this); }
+		dequeIterator &			operator--	(void)									{ this->prev(); return (*this); }
+		dequeIterator			operator++	(int)									{ dequeIterator<IsConst> x(*this); this->next(); return (x); }
+		dequeIterator			operator--	(int)									{ dequeIterator<IsConst> x(*this); this->prev(); return (x); }
+		// Operation
+		dequeIterator			operator+	(difference_type n) const				{ dequeIterator<IsConst> x(*this); x.move(n); return (x); }
+		dequeIterator			operator-	(difference_type n) const				{ dequeIterator<IsConst> x(*this); x.move(-n); return (x); }
+		template <bool B>
+		difference_type			operator-	(const dequeIterator<B> & x) const
+			{ return ((_node - x.getNode()) * difference_type(block_size) + (_cur - _first) - (x.getPtr() - *x.getNode())); }
+		// Dereference
+		value_type &			operator[]	(difference_type n) const				{ return (*(*this + n)); }
+		value_type &			operator*	(void) const							{ return (*_cur); }
+		value_type *			operator->	(void) const							{ return (_cur); }
+		// Member functions
+		T *						getPtr		(void) const							{ return (_cur); }
+		T **					getNode		(void) const							{ return (_node); }
+		// Friend functions
+		friend dequeIterator	operator+	(difference_type n, const dequeIterator & x)	{ return (x + n); }
+
+	private:
+		T *						_cur;		// current element
+		T *						_first;		// start of the current block
+		T **					_node;		// slot of the current block in the map
+
+		// past the last slot of a block the iterator moves to the start of the next block,
+		// whose pointer is NULL when the block is not allocated: that is the end() iterator.
+		void next (void)
+		{
+			if (++_cur == _first + block_size)
+			{
+				_first = *++_node;
+				_cur = _first;
+			}
+		}
+
+		void prev (void)
+		{
+			if (_cur == _first)
+			{
+				_first = *--_node;
+				_cur = _first + block_size;
+			}
+			--_cur;
+		}
+
+		void move (difference_type n)
+		{
+			difference_type		off = n + (_cur - _first);
+			difference_type		blk = difference_type(block_size);
+
+			if (off >= 0 && off < blk)
+				_cur += n;
+			else
+			{
+				difference_type	node_off = (off > 0) ? off / blk : -((-off - 1) / blk) - 1;
+
+				_node += node_off;
+				_first = *_node;
+				_cur = _first + (off - node_off * blk);
+			}
+		}
+	}; // Iterator
+
+	//////////////////
+	// Member types //
+	//////////////////
+
+	typedef		T												value_type;
+	typedef		Alloc											allocator_type;
+	typedef		typename allocator_type::reference				reference;
+	typedef		typename allocator_type::const_reference		const_reference;
+	typedef		typename allocator_type::pointer				pointer;
+	typedef		typename allocator_type::const_pointer			const_pointer;
+	typedef		dequeIterator<false>							iterator;
+	typedef		dequeIterator<true>								const_iterator;
+	typedef		ft::reverse_iterator<iterator>					reverse_iterator;
+	typedef		ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+	typedef		typename dequeIterator<false>::difference_type	difference_type;
+	typedef		typename dequeIterator<false>::size_type		size_type;
+
+	//////////////////
+	// Constructors //
+	//////////////////
+
+	// Constructs an empty container, with no elements and no block.
+	explicit deque (const allocator_type & alloc = allocator_type())
+	{
+		this->_init(alloc);
+	}
+
+	// Constructs a container with n elements. Each element is a copy of val.
+	explicit deque (size_type n, const value_type & val = value_type(), const allocator_type & alloc = allocator_type())
+	{
+		this->_init(alloc);
+		this->assign(n, val);
+	}
+
+	// Constructs a container with as many elements as the range [first,last), in the same order.
+	template <class InputIterator>
+	deque (InputIterator first, InputIterator last, const allocator_type & alloc = allocator_type(),
+	typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
+	{
+		this->_init(alloc);
+		this->assign(first, last);
+	}
+
+	// Constructs a container with a copy of each of the elements in x, in the same order.
+	deque (const deque & x)
+	{
+		this->_init(x._alloc);
+		this->assign(x.begin(), x.end());
+	}
+
+	/////////////////
+	// Destructors //
+	/////////////////
+
+	// Destroys all container elements, and deallocates the blocks and the map.
+	~deque (void)
+	{
+		this->clear();
+		this->_free_spares();
+		_map_alloc.deallocate(_map, _map_size);
+	}
+
+	/////////////////////////
+	// Assignment operator //
+	/////////////////////////
+
+	deque & operator= (const deque & x)
+	{
+		if (this != &x)
+			this->assign(x.begin(), x.end());
+		return (*this);
+	}
+
+	///////////////
+	// Iterators //
+	///////////////
+
+	iterator begin (void)
+	{
+		return (this->_at(0));
+	}
+
+	const_iterator begin (void) const
+	{
+		return (const_cast<deque *>(this)->_at(0));
+	}
+
+	iterator end (void)
+	{
+		return (this->_at(_size));
+	}
+
+	const_iterator end (void) const
+	{
+		return (const_cast<deque *>(this)->_at(_size));
+	}
+
+	///////////////////////
+	// Reverse iterators //
+	///////////////////////
+
+	reverse_iterator rbegin (void)
+	{
+		return (reverse_iterator(this->end()));
+	}
+
+	const_reverse_iterator rbegin (void) const
+	{
+		return (const_reverse_iterator(this->end()));
+	}
+
+	reverse_iterator rend (void)
+	{
+		return (reverse_iterator(this->begin()));
+	}
+
+	const_reverse_iterator rend (void) const
+	{
+		return (const_reverse_iterator(this->begin()));
+	}
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	size_type size (void) const
+	{
+		return (_size);
+	}
+
+	size_type max_size (void) const
+	{
+		return (_alloc.max_size());
+	}
+
+	// Resizes the container so that it contains n elements.
+	void resize (size_type n, value_type val = value_type())
+	{
+		while (_size > n)
+			this->pop_back();
+		while (_size < n)
+			this->push_back(val);
+	}
+
+	bool empty (void) const
+	{
+		return (_size == 0);
+	}
+
+	// Gives the spare blocks back and shrinks the map to the blocks in use plus a free slot
+	// at each end. No element moves.
+	void shrink_to_fit (void)
+	{
+		this->_free_spares();
+
+		size_type		first = _start / block_size;
+		size_type		used = (_size + _start % block_size) / block_size + 1;
+		size_type		new_size = used + 2;
+
+		if (new_size >= _map_size)
+			return ;
+
+		T **			new_map = _map_alloc.allocate(new_size);
+
+		new_map[0] = NULL;
+		for (size_type i = 0 ; i < used ; i++)
+			new_map[i + 1] = _map[first + i];
+		new_map[new_size - 1] = NULL;
+		_map_alloc.deallocate(_map, _map_size);
+		_map = new_map;
+		_map_size = new_size;
+		_start = block_size + _start % block_size;
+	}
+
+	///////////////////
+	// Member access //
+	///////////////////
+
+	// Returns a reference to the element at position n in the deque container.
+	reference operator[] (size_type n)
+	{
+		return (_map[(_start + n) / block_size][(_start + n) % block_size]);
+	}
+
+	const_reference operator[] (size_type n) const
+	{
+		return (_map[(_start + n) / block_size][(_start + n) % block_size]);
+	}
+
+	// Same as operator[] but throws out_of_range when n is not a position of the container.
+	reference at (size_type n)
+	{
+		if (n >= _size)
+			throw std::out_of_range("deque::_M_range_check: __n (which is " + ft::to_string(n) + ")>= this->size() (which is " + ft::to_string(_size) + ")");
+		return ((*this)[n]);
+	}
+
+	const_reference at (size_type n) const
+	{
+		if (n >= _size)
+			throw std::out_of_range("deque::_M_range_check: __n (which is " + ft::to_string(n) + ")>= this->size() (which is " + ft::to_string(_size) + ")");
+		return ((*this)[n]);
+	}
+
+	reference front (void)
+	{
+		return ((*this)[0]);
+	}
+
+	const_reference front (void) const
+	{
+		return ((*this)[0]);
+	}
+
+	reference back (void)
+	{
+		return ((*this)[_size - 1]);
+	}
+
+	const_reference back (void) const
+	{
+		return ((*this)[_size - 1]);
+	}
+
+	//////////////////////////
+	// Assignment modifiers //
+	//////////////////////////
+
+	// Assigns the elements of the range [first,last), replacing the current contents.
+	template <class InputIterator>
+	void assign (InputIterator first, InputIterator last,
+	typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
+	{
+		this->clear();
+		while (first != last)
+			this->push_back(*first++);
+	}
+
+	// Assigns n copies of val, replacing the current contents.
+	void assign (size_type n, const value_type & val)
+	{
+		value_type		tmp(val); // val may be one of our own elements
+
+		this->clear();
+		while (n-- > 0)
+			this->push_back(tmp);
+	}
+
+	/////////////////////////
+	// Insertion modifiers //
+	/////////////////////////
+
+	// Inserts val before position, the elements on the shorter side of position are shifted.
+	iterator insert (iterator position, const value_type & val)
+	{
+		size_type		off = position - this->begin();
+
+		this->insert(position, 1, val);
+		return (this->begin() + off);
+	}
+
+	// Inserts n copies of val before position.
+	void insert (iterator position, size_type n, const value_type & val)
+	{
+		size_type		off = position - this->begin();
+		value_type		tmp(val);
+
+		if (off < _size / 2)
+		{
+			for (size_type i = 0 ; i < n ; i++)
+				this->push_front(tmp);
+			this->_rotate(0, n, n + off);
+		}
+		else
+		{
+			size_type	old = _size;
+
+			for (size_type i = 0 ; i < n ; i++)
+				this->push_back(tmp);
+			this->_rotate(off, old, _size);
+		}
+	}
+
+	// Inserts the elements of the range [first,last) before position.
+	template <class InputIterator>
+	void insert (iterator position, InputIterator first, InputIterator last,
+	typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
+	{
+		size_type		off = position - this->begin();
+
+		if (off < _size / 2)
+		{
+			size_type	n = 0;
+
+			for ( ; first != last ; n++)
+				this->push_front(*first++);
+			this->_reverse(0, n);
+			this->_rotate(0, n, n + off);
+		}
+		else
+		{
+			size_type	old = _size;
+
+			while (first != last)
+				this->push_back(*first++);
+			this->_rotate(off, old, _size);
+		}
+	}
+
+	///////////////////////
+	// Erasure modifiers //
+	///////////////////////
+
+	iterator erase (iterator position)
+	{
+		return (this->erase(position, position + 1));
+	}
+
+	// Removes [first,last): the shorter side is shifted over the gap, then popped.
+	iterator erase (iterator first, iterator last)
+	{
+		size_type		off = first - this->begin();
+		size_type		n = last - first;
+
+		if (n == 0) // nothing to shift, and moving an element onto itself may empty it
+			return (first);
+		if (off < _size - off - n)
+		{
+			for (size_type i = off ; i > 0 ; i--)
+				(*this)[i - 1 + n] = FT_MOVE_((*this)[i - 1]);
+			for (size_type i = 0 ; i < n ; i++)
+				this->pop_front();
+		}
+		else
+		{
+			for (size_type i = off ; i + n < _size ; i++)
+				(*this)[i] = FT_MOVE_((*this)[i + n]);
+			for (size_type i = 0 ; i < n ; i++)
+				this->pop_back();
+		}
+		return (this->begin() + off);
+	}
+
+	//////////////////////
+	// Common modifiers //
+	//////////////////////
+
+	// Adds a new element at the end, at worst a block is allocated or the map grown.
+	void push_back (const value_type & val)
+	{
+		size_type		pos = _start + _size;
+
+		if ((pos + 1) / block_size >= _map_size)
+			this->_grow_map(1, false);
+		pos = _start + _size;
+		if (_map[pos / block_size] == NULL)
+			_map[pos / block_size] = this->_new_block(_spare_back);
+		_alloc.construct(_map[pos / block_size] + pos % block_size, val);
+		_size++;
+	}
+
+	// Adds a new element at the beginning, at worst a block is allocated or the map grown.
+	void push_front (const value_type & val)
+	{
+		if (_start == 0)
+			this->_grow_map(1, true);
+
+		size_type		pos = _start - 1;
+
+		if (_map[pos / block_size] == NULL)
+			_map[pos / block_size] = this->_new_block(_spare_front);
+		_alloc.construct(_map[pos / block_size] + pos % block_size, val);
+		_start--;
+		_size++;
+	}
+
+	// Removes the last element, its block is kept as the spare of the back when it becomes empty.
+	void pop_back (void)
+	{
+		if (_size == 0)
+			return ;
+
+		size_type		pos = _start + _size - 1;
+
+		_alloc.destroy(_map[pos / block_size] + pos % block_size);
+		_size--;
+		if (pos % block_size == 0 || _size == 0)
+			this->_release_block(pos / block_size, _spare_back);
+	}
+
+	// Removes the first element, its block is kept as the spare of the front when it becomes empty.
+	void pop_front (void)
+	{
+		if (_size == 0)
+			return ;
+
+		size_type		pos = _start;
+
+		_alloc.destroy(_map[pos / block_size] + pos % block_size);
+		_start++;
+		_size--;
+		if (_start % block_size == 0 || _size == 0)
+			this->_release_block(pos / block_size, _spare_front);
+	}
+
+	// Exchanges the content of the container by the content of x.
+	void swap (deque & x)
+	{
+		ft::swap(_alloc, x._alloc);
+		ft::swap(_map_alloc, x._map_alloc);
+		ft::swap(_map, x._map);
+		ft::swap(_map_size, x._map_size);
+		ft::swap(_start, x._start);
+		ft::swap(_size, x._size);
+		ft::swap(_spare_front, x._spare_front);
+		ft::swap(_spare_back, x._spare_back);
+	}
+
+	// Removes all elements, releasing their blocks. The map and one spare block are kept.
+	void clear (void)
+	{
+		while (_size)
+			this->pop_back();
+	}
+
+	///////////////
+	// Allocator //
+	///////////////
+
+	allocator_type get_allocator (void) const
+	{
+		return (_alloc);
+	}
+
+	///////////////////////
+	// Private functions //
+	///////////////////////
+private:
+	typedef typename Alloc::template rebind<T *>::other		map_allocator_type;
+
+	void _init (const allocator_type & alloc)
+	{
+		_alloc = alloc;
+		_map_alloc = map_allocator_type(alloc);
+		_map_size = 8;
+		_map = _map_alloc.allocate(_map_size);
+		for (size_type i = 0 ; i < _map_size ; i++)
+			_map[i] = NULL;
+		_start = (_map_size / 2) * block_size;
+		_size = 0;
+		_spare_front = NULL;
+		_spare_back = NULL;
+	}
+
+	// iterator to the element n.
+	iterator _at (size_type n)
+	{
+		size_type		pos = _start + n;
+
+		return (iterator(_map + pos / block_size, _map[pos / block_size] + pos % block_size));
+	}
+
+	// block for a new element at one end: the spare of that end, or a new allocation.
+	T * _new_block (T *& spare)
+	{
+		T *		block = spare;
+
+		if (block == NULL)
+			return (_alloc.allocate(block_size));
+		spare = NULL;
+		return (block);
+	}
+
+	// the block b is empty: it becomes the spare of its end, or is deallocated when that end
+	// already has one. Pushes and pops across a block boundary do not reach the allocator.
+	void _release_block (size_type b, T *& spare)
+	{
+		if (spare == NULL)
+			spare = _map[b];
+		else
+			_alloc.deallocate(_map[b], block_size);
+		_map[b] = NULL;
+		if (_size == 0)
+			_start = (_map_size / 2) * block_size;
+	}
+
+	void _free_spares (void)
+	{
+		if (_spare_front)
+			_alloc.deallocate(_spare_front, block_size);
+		if (_spare_back)
+			_alloc.deallocate(_spare_back, block_size);
+		_spare_front = NULL;
+		_spare_back = NULL;
+	}
+
+	// make room for extra blocks at the front or at the back of the map. The used blocks are
+	// recentered when the map is less than half full, otherwise the map is doubled.
+	// Only block pointers are copied: the cost is bounded by the number of blocks.
+	void _grow_map (size_type extra, bool front)
+	{
+		size_type		first = _start / block_size;
+		size_type		used = (_size + _start % block_size) / block_size + 1;
+		size_type		new_size = _map_size;
+
+		if ((used + extra) * 2 > _map_size)
+			new_size = _map_size * 2 + extra;
+
+		size_type		new_first = (new_size - used) / 2 + (front ? extra : 0);
+		T **			new_map = _map;
+
+		if (new_first + used + 1 > new_size)
+			new_first = new_size - used - 1;
+		if (new_size != _map_size)
+		{
+			new_map = _map_alloc.allocate(new_size);
+			for (size_type i = 0 ; i < new_size ; i++)
+				new_map[i] = NULL;
+			for (size_type i = 0 ; i < used ; i++)
+				new_map[new_first + i] = _map[first + i];
+			_map_alloc.deallocate(_map, _map_size);
+		}
+		else if (new_first < first)
+		{
+			for (size_type i = 0 ; i < used ; i++)
+			{
+				new_map[new_first + i] = _map[first + i];
+				_map[first + i] = NULL;
+			}
+		}
+		else if (new_first > first)
+		{
+			for (size_type i = used ; i > 0 ; i--)
+			{
+				new_map[new_first + i - 1] = _map[first + i - 1];
+				_map[first + i - 1] = NULL;
+			}
+		}
+		_map = new_map;
+		_map_size = new_size;
+		_start = new_first * block_size + _start % block_size;
+	}
+
+	// reverse the elements [first, last).
+	void _reverse (size_type first, size_type last)
+	{
+		while (first + 1 < last)
+			ft::swap((*this)[first++], (*this)[--last]);
+	}
+
+	// rotate [first, last) so that middle becomes the first element.
+	void _rotate (size_type first, size_type middle, size_type last)
+	{
+		this->_reverse(first, middle);
+		this->_reverse(middle, last);
+		this->_reverse(first, last);
+	}
+
+	//////////////////////
+	// Member variables //
+	//////////////////////
+
+	allocator_type		_alloc;
+	map_allocator_type	_map_alloc;
+	T **				_map;		// block pointers, NULL for the blocks holding no element
+	size_type			_map_size;
+	size_type			_start;		// position of the first element from the start of the map
+	size_type			_size;
+	T *					_spare_front;	// empty blocks kept for the next push at each end
+	T *					_spare_back;
+}; // Deque
+
+	template <class T, class Alloc>
+	const std::size_t deque<T, Alloc>::block_size;
+
+	//////////////////////////
+	// Relational operators //
+	//////////////////////////
+
+	template <class T, class Alloc>
+	bool operator== (const deque<T,Alloc> & lhs, const deque<T,Alloc> & rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, class Alloc>
+	bool operator< (const deque<T,Alloc> & lhs, const deque<T,Alloc> & rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, class Alloc>
+	bool operator!= (const deque<T,Alloc> & lhs, const deque<T,Alloc> & rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator<= (const deque<T,Alloc> & lhs, const deque<T,Alloc> & rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator> (const deque<T,Alloc> & lhs, const deque<T,Alloc> & rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, class Alloc>
+	bool operator>= (const deque<T,Alloc> & lhs, const deque<T,Alloc> & rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template <class T, class Alloc>
+	void swap (deque<T,Alloc> & x, deque<T,Alloc> & y)
+	{
+		x.swap(y);
+	}
+
+} // Namespace ft
+
+#endif
@@ -0,0 +1,538 @@
+#ifndef FLAT_MAP_HPP
+# define FLAT_MAP_HPP
+
+# include <algorithm>
+# include "vector.hpp"
+
+// sorted vector associative container
+//	A flat_map keeps its elements in one ft::vector sorted by key: lookups are a
+//	binary search over contiguous memory and iteration is a linear scan, with no
+//	node allocated per element. Inserting or erasing in the middle shifts the tail,
+//	so it is meant for read-mostly tables, batches should go through the range
+//	insert which sorts and merges them in one pass.
+//	Iterators are the vector's (random access) and, unlike map, are invalidated
+//	by every insertion and erasure. The key of an element must not be modified.
+
+namespace ft
+{
+template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<Key, T> > >
+class flat_map {
+public:
+
+	//////////////////
+	// Member types //
+	//////////////////
+
+	class		ValueCompare;
+
+	typedef		Key												key_type;
+	typedef		T												mapped_type;
+	typedef		ft::pair<key_type, mapped_type>					value_type;
+	typedef		Compare											key_compare;
+	typedef		ValueCompare									value_compare;
+	typedef		Alloc											allocator_type;
+	typedef		ft::vector<value_type, allocator_type>			vector_type;
+	typedef		typename vector_type::reference					reference;
+	typedef		typename vector_type::const_reference			const_reference;
+	typedef		typename vector_type::pointer					pointer;
+	typedef		typename vector_type::const_pointer				const_pointer;
+	typedef		typename vector_type::iterator					iterator;
+	typedef		typename vector_type::const_iterator			const_iterator;
+	typedef		typename vector_type::reverse_iterator			reverse_iterator;
+	typedef		typename vector_type::const_reverse_iterator	const_reverse_iterator;
+	typedef		typename vector_type::difference_type			difference_type;
+	typedef		typename vector_type::size_type					size_type;
+
+	///////////////////
+	// Value compare //
+	///////////////////
+
+	class ValueCompare {
+	public:
+		friend			class			flat_map;
+		typedef			bool			result_type;
+		typedef			value_type		first_argument_type;
+		typedef			value_type		second_argument_type;
+		bool			operator()		(const value_type & x, const value_type & y) const
+			{ return (comp(x.first, y.first)); }
+	protected:
+		ValueCompare	(Compare c)		: comp(c) {}
+		Compare			comp;
+	};
+
+	//////////////////
+	// Constructors //
+	//////////////////
+
+	//	Constructs an empty container, with no elements.
+	explicit flat_map (const key_compare & comp = key_compare(), const allocator_type & alloc = allocator_type())
+		: _data(alloc), _comp(comp) {}
+
+	//	Constructs a container with the elements of the range [first,last), sorted and merged in one go.
+	//	When a key appears several times only its first element is kept, as map does.
+	template <class InputIterator>
+	flat_map (InputIterator first, InputIterator last, const key_compare & comp = key_compare(), const allocator_type & alloc = allocator_type(),
+	typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+		: _data(alloc), _comp(comp)
+	{
+		this->insert(first, last);
+	}
+
+	//	Constructs a container from a range already sorted by key without duplicates, in O(n).
+	template <class InputIterator>
+	flat_map (sorted_unique_t, InputIterator first, InputIterator last, const key_compare & comp = key_compare(),
+	const allocator_type & alloc = allocator_type())
+		: _data(first, last, alloc), _comp(comp) {}
+
+	//	Constructs a container with a copy of each of the elements in x.
+	flat_map (const flat_map & x) : _data(x._data), _comp(x._comp) {}
+
+	/////////////////
+	// Destructors //
+	/////////////////
+
+	~flat_map (void) {}
+
+	/////////////////////////
+	// Assignment operator //
+	/////////////////////////
+
+	// Copies all the elements from x into the container, changing its size accordingly.
+	flat_map & operator= (const flat_map & x)
+	{
+		_data = x._data;
+		_comp = x._comp;
+		return (*this);
+	}
+
+	///////////////
+	// Iterators //
+	///////////////
+
+	iterator begin (void)
+	{
+		return (_data.begin());
+	}
+
+	const_iterator begin (void) const
+	{
+		return (_data.begin());
+	}
+
+	iterator end (void)
+	{
+		return (_data.end());
+	}
+
+	const_iterator end (void) const
+	{
+		return (_data.end());
+	}
+
+	reverse_iterator rbegin (void)
+	{
+		return (_data.rbegin());
+	}
+
+	const_reverse_iterator rbegin (void) const
+	{
+		return (_data.rbegin());
+	}
+
+	reverse_iterator rend (void)
+	{
+		return (_data.rend());
+	}
+
+	const_reverse_iterator rend (void) const
+	{
+		return (_data.rend());
+	}
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	bool empty (void) const
+	{
+		return (_data.empty());
+	}
+
+	size_type size (void) const
+	{
+		return (_data.size());
+	}
+
+	size_type max_size (void) const
+	{
+		return (_data.max_size());
+	}
+
+	size_type capacity (void) const
+	{
+		return (_data.capacity());
+	}
+
+	// Requests room for n elements, the insertions up to n do not reallocate.
+	void reserve (size_type n)
+	{
+		_data.reserve(n);
+	}
+
+	void shrink_to_fit (void)
+	{
+		_data.shrink_to_fit();
+	}
+
+	///////////////////
+	// Member access //
+	///////////////////
+
+	// If k matches the key of an element in the container, the function returns a
+	// reference to its mapped value, otherwise a default mapped value is inserted for k.
+	mapped_type & operator[] (const key_type & k)
+	{
+		iterator	it = this->lower_bound(k);
+
+		if (it == this->end() || _comp(k, it->first))
+			it = _data.insert(it, value_type(k, mapped_type()));
+		return (it->second);
+	}
+
+	/////////////////////////
+	// Insertion modifiers //
+	/////////////////////////
+
+	// Inserts val if its key is not in the container yet, the elements after it are shifted.
+	ft::pair<iterator,bool> insert (const value_type & val)
+	{
+		iterator	it = this->lower_bound(val.first);
+
+		if (it != this->end() && !_comp(val.first, it->first))
+			return (ft::make_pair(it, false));
+		return (ft::make_pair(_data.insert(it, val), true));
+	}
+
+	// When val goes right before position no search is done.
+	iterator insert (iterator position, const value_type & val)
+	{
+		if ((position == this->begin() || _comp((position - 1)->first, val.first))
+			&& (position == this->end() || _comp(val.first, position->first)))
+			return (_data.insert(position, val));
+		return (this->insert(val).first);
+	}
+
+	// The range is copied, sorted and merged with the current elements in one pass.
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last,
+	typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+	{
+		vector_type		batch(first, last, _data.get_allocator());
+
+		if (batch.empty())
+			return ;
+		std::stable_sort(batch.begin(), batch.end(), this->value_comp());
+		batch.erase(std::unique(batch.begin(), batch.end(), _equal_keys(_comp)), batch.end());
+		this->_merge(batch.begin(), batch.end());
+	}
+
+	// Bulk sorted insert: the range is already sorted by key without duplicates,
+	// it is merged with the current elements in one pass with no sort.
+	template <class InputIterator>
+	void insert (sorted_unique_t, InputIterator first, InputIterator last)
+	{
+		this->_insert_sorted(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+	}
+
+	///////////////////////
+	// Erasure modifiers //
+	///////////////////////
+
+	void erase (iterator position)
+	{
+		_data.erase(position);
+	}
+
+	size_type erase (const key_type & k)
+	{
+		iterator	it = this->find(k);
+
+		if (it == this->end())
+			return (0);
+		_data.erase(it);
+		return (1);
+	}
+
+	void erase (iterator first, iterator last)
+	{
+		_data.erase(first, last);
+	}
+
+	//////////////////////
+	// Common modifiers //
+	//////////////////////
+
+	void swap (flat_map & x)
+	{
+		_data.swap(x._data);
+		ft::swap(_comp, x._comp);
+	}
+
+	void clear (void)
+	{
+		_data.clear();
+	}
+
+	///////////////
+	// Observers //
+	///////////////
+
+	key_compare key_comp (void) const
+	{
+		return (_comp);
+	}
+
+	value_compare value_comp (void) const
+	{
+		return (value_compare(_comp));
+	}
+
+	///////////////////////
+	// Search operations //
+	///////////////////////
+
+	iterator find (const key_type & k)
+	{
+		iterator	it = this->lower_bound(k);
+
+		if (it == this->end() || _comp(k, it->first))
+			return (this->end());
+		return (it);
+	}
+
+	const_iterator find (const key_type & k) const
+	{
+		const_iterator	it = this->lower_bound(k);
+
+		if (it == this->end() || _comp(k, it->first))
+			return (this->end());
+		return (it);
+	}
+
+	size_type count (const key_type & k) const
+	{
+		return (this->find(k) != this->end());
+	}
+
+	//////////////////////
+	// Bound operations //
+	//////////////////////
+
+	// Binary search for the first element whose key does not go before k.
+	iterator lower_bound (const key_type & k)
+	{
+		return (this->begin() + this->_lower_index(k));
+	}
+
+	const_iterator lower_bound (const key_type & k) const
+	{
+		return (this->begin() + this->_lower_index(k));
+	}
+
+	// Binary search for the first element whose key goes after k.
+	iterator upper_bound (const key_type & k)
+	{
+		return (this->begin() + this->_upper_index(k));
+	}
+
+	const_iterator upper_bound (const key_type & k) const
+	{
+		return (this->begin() + this->_upper_index(k));
+	}
+
+	ft::pair<iterator,iterator> equal_range (const key_type & k)
+	{
+		iterator	it = this->lower_bound(k);
+
+		if (it == this->end() || _comp(k, it->first))
+			return (ft::make_pair(it, it));
+		return (ft::make_pair(it, it + 1));
+	}
+
+	ft::pair<const_iterator,const_iterator> equal_range (const key_type & k) const
+	{
+		const_iterator	it = this->lower_bound(k);
+
+		if (it == this->end() || _comp(k, it->first))
+			return (ft::make_pair(it, it));
+		return (ft::make_pair(it, it + 1));
+	}
+
+	///////////////
+	// Allocator //
+	///////////////
+
+	allocator_type get_allocator (void) const
+	{
+		return (_data.get_allocator());
+	}
+
+	///////////////////////
+	// Private functions //
+	///////////////////////
+private:
+	// keys a and b are equivalent when neither goes before the other.
+	struct _equal_keys
+	{
+		_equal_keys		(const Compare & c) : comp(c) {}
+		bool			operator() (const value_type & a, const value_type & b) const
+			{ return (!comp(a.first, b.first) && !comp(b.first, a.first)); }
+		Compare			comp;
+	};
+
+	size_type _lower_index (const key_type & k) const
+	{
+		size_type	lo = 0;
+		size_type	n = _data.size();
+
+		while (n > 0)
+		{
+			size_type	half = n / 2;
+
+			if (_comp(_data[lo + half].first, k))
+			{
+				lo += half + 1;
+				n -= half + 1;
+			}
+			else
+				n = half;
+		}
+		return (lo);
+	}
+
+	size_type _upper_index (const key_type & k) const
+	{
+		size_type	lo = 0;
+		size_type	n = _data.size();
+
+		while (n > 0)
+		{
+			size_type	half = n / 2;
+
+			if (!_comp(k, _data[lo + half].first))
+			{
+				lo += half + 1;
+				n -= half + 1;
+			}
+			else
+				n = half;
+		}
+		return (lo);
+	}
+
+	// a single pass range is read into a vector first, its size is needed up front.
+	template <class InputIterator>
+	void _insert_sorted (InputIterator first, InputIterator last, ft::input_iterator_tag)
+	{
+		vector_type		batch(first, last, _data.get_allocator());
+
+		this->_merge(batch.begin(), batch.end());
+	}
+
+	template <class ForwardIterator>
+	void _insert_sorted (ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+	{
+		this->_merge(first, last);
+	}
+
+	// merges the sorted unique range [first, last) into the elements, the elements already
+	// in the container win over equivalent keys of the range. When the whole range goes
+	// after the last element it is appended in place, otherwise both sequences are merged
+	// into a new buffer which replaces the current one.
+	template <class ForwardIterator>
+	void _merge (ForwardIterator first, ForwardIterator last)
+	{
+		if (first == last)
+			return ;
+		if (_data.empty() || _comp(_data.back().first, first->first))
+		{
+			_data.insert(_data.end(), first, last);
+			return ;
+		}
+
+		vector_type		merged(_data.get_allocator());
+		iterator		it = _data.begin();
+
+		merged.reserve(_data.size() + ft::distance(first, last));
+		while (it != _data.end() && first != last)
+		{
+			if (_comp(it->first, first->first))
+				merged.push_back(*it++);
+			else if (_comp(first->first, it->first))
+				merged.push_back(*first++);
+			else
+			{
+				merged.push_back(*it++);
+				++first;
+			}
+		}
+		for ( ; it != _data.end() ; ++it)
+			merged.push_back(*it);
+		for ( ; first != last ; ++first)
+			merged.push_back(*first);
+		_data.swap(merged);
+	}
+
+	vector_type		_data;
+	key_compare		_comp;
+}; // Flat map
+
+	//////////////////////////
+	// Relational operators //
+	//////////////////////////
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator== (const flat_map<Key,T,Compare,Alloc> & lhs, const flat_map<Key,T,Compare,Alloc> & rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<  (const flat_map<Key,T,Compare,Alloc> & lhs, const flat_map<Key,T,Compare,Alloc> & rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator!= (const flat_map<Key,T,Compare,Alloc> & lhs, const flat_map<Key,T,Compare,Alloc> & rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<= (const flat_map<Key,T,Compare,Alloc> & lhs, const flat_map<Key,T,Compare,Alloc> & rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>  (const flat_map<Key,T,Compare,Alloc> & lhs, const flat_map<Key,T,Compare,Alloc> & rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>= (const flat_map<Key,T,Compare,Alloc> & lhs, const flat_map<Key,T,Compare,Alloc> & rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	void swap (flat_map<Key,T,Compare,Alloc> & x, flat_map<Key,T,Compare,Alloc> & y)
+	{
+		x.swap(y);
+	}
+
+} // Namespace ft
+
+#endif
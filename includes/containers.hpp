@@ -4,13 +4,16 @@
 //# include <iostream>
 # include <vector>
 # include <cstddef>
+# include <cstring>
 # include <iterator>
 # include <sstream>
 # include "algorithm.hpp"
 # include "iterator.hpp"
 //# include "string.hpp"
 # include "type_traits.hpp"
+# include "is_trivially_copyable.hpp"
 # include "utility.hpp"
+# include "growth_policy.hpp"
 
 // RED and BLACK binary search tree
 // implementaion helpers
@@ -23,10 +26,18 @@
 #  define BLACK_ false
 # endif
 
-// size or capacity define
+// C++11 build mode: move semantics and emplacement are only compiled
+// when the headers are built with -std=c++11 or later.
 
-# ifndef SIZE_OR_CAP_
-#  define SIZE_OR_CAP_ _size
+# if __cplusplus >= 201103L && !defined(FT_CXX11_)
+#  define FT_CXX11_ 1
+# endif
+
+# ifdef FT_CXX11_
+#  include <utility>
+#  define FT_MOVE_(x) std::move(x)
+# else
+#  define FT_MOVE_(x) (x)
 # endif
 
 #endif
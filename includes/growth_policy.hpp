@@ -0,0 +1,164 @@
+#ifndef GROWTH_POLICY_HPP
+# define GROWTH_POLICY_HPP
+
+# include <cstddef>
+# include <memory>
+# include "type_traits.hpp"
+
+namespace ft
+{
+	/////////////////
+	// Usable size //
+	/////////////////
+
+	// Number of bytes an allocator really hands out for a request of n bytes.
+	// The default models glibc malloc behind std::allocator: small chunks carry an 8 bytes
+	// header and are rounded to 16 bytes, chunks above the mmap threshold are whole pages
+	// with a 16 bytes header. Specialize it for allocators with another granularity.
+	// It is a model and not a query: malloc_usable_size only answers for a block already
+	// allocated, while the growth policies need the answer before allocating.
+
+	template <class Alloc>
+	struct usable_size
+	{
+		static const std::size_t	page = 4096;
+		static const std::size_t	mmap_threshold = 128 * 1024;
+
+		static std::size_t bytes (std::size_t n)
+		{
+			if (n + 16 >= mmap_threshold)
+				return (((n + 16 + page - 1) / page) * page - 16);
+			if (n < 24)
+				return (24);
+			return (((n + 8 + 15) / 16) * 16 - 8);
+		}
+	};
+
+	////////////////////
+	// Can reallocate //
+	////////////////////
+
+	// Tells whether Alloc has a reallocate(p, old_n, new_n) member resizing a block
+	// while keeping its bytes, which lets ft::vector grow trivially copyable elements
+	// without copying them (see mmap_allocator.hpp).
+
+	template <class Alloc>
+	struct can_reallocate : public false_type {};
+
+	/////////////////////
+	// Growth policies //
+	/////////////////////
+
+	// A growth policy decides the capacity ft::vector grows to when it is full.
+	// grow<Alloc>(current, needed) returns the new capacity in elements: current is the
+	// number of elements held, needed the number of elements that must fit (needed > current).
+	// The vector clamps the result to max_size().
+	// release<Alloc>(size, capacity) is asked after elements are removed and returns the
+	// capacity the storage is shrunk to, returning capacity keeps the storage.
+
+	// never give storage back, like std::vector. The base of the growth policies below.
+	struct release_never
+	{
+		template <class Alloc>
+		static std::size_t release (std::size_t, std::size_t capacity)
+		{
+			return (capacity);
+		}
+	};
+
+	// double the size, the classic amortized O(1) growth.
+	struct growth_double : public release_never
+	{
+		template <class Alloc>
+		static std::size_t grow (std::size_t current, std::size_t needed)
+		{
+			if (needed > current * 2)
+				return (needed);
+			else if (current > 0)
+				return (current * 2);
+			return (1);
+		}
+	};
+
+	// grow by half the size: at most a third of the storage is unused after a growth step
+	// and freed blocks can be reused by later steps.
+	struct growth_one_and_half : public release_never
+	{
+		template <class Alloc>
+		static std::size_t grow (std::size_t current, std::size_t needed)
+		{
+			std::size_t		cap = current + current / 2;
+
+			if (cap < needed)
+				return (needed);
+			return (cap);
+		}
+	};
+
+	// grow by half the size then round up to what the allocator really hands out
+	// (see usable_size), so the slack of the malloc bucket or of the last page is used.
+	struct growth_rounded : public release_never
+	{
+		template <class Alloc>
+		static std::size_t grow (std::size_t current, std::size_t needed)
+		{
+			std::size_t		elem = sizeof(typename Alloc::value_type);
+			std::size_t		cap = growth_one_and_half::grow<Alloc>(current, needed);
+			std::size_t		usable = usable_size<Alloc>::bytes(cap * elem) / elem;
+
+			if (usable > cap)
+				return (usable);
+			return (cap);
+		}
+	};
+
+	// double the size until the storage reaches Limit bytes, then grow linearly by Limit bytes
+	// at a time: huge vectors never waste more than Limit bytes.
+	template <std::size_t Limit = 64 * 1024 * 1024>
+	struct growth_capped : public release_never
+	{
+		template <class Alloc>
+		static std::size_t grow (std::size_t current, std::size_t needed)
+		{
+			std::size_t		elem = sizeof(typename Alloc::value_type);
+			std::size_t		step = current;
+
+			if (current * elem > Limit)
+				step = (Limit / elem > 0) ? Limit / elem : 1;
+			else if (step == 0)
+				step = 1;
+			if (current + step < needed)
+				return (needed);
+			return (current + step);
+		}
+	};
+
+	////////////////////
+	// Release policy //
+	////////////////////
+
+	// Growth policy adapter giving storage back: once the size falls below 1/Fraction of
+	// the capacity, the storage shrinks to the capacity Growth would grow the current size to,
+	// or is released when the vector is empty.
+	// The gap between the shrink point and the new capacity is the hysteresis: a vector going
+	// back and forth around one size does not reallocate on each step. Fraction must be
+	// above the growth factor (4 for growth_double).
+	template <class Growth = growth_double, std::size_t Fraction = 4>
+	struct release_below : public Growth
+	{
+		template <class Alloc>
+		static std::size_t release (std::size_t size, std::size_t capacity)
+		{
+			if (size * Fraction >= capacity)
+				return (capacity);
+			if (size == 0)
+				return (0);
+
+			std::size_t		cap = Growth::template grow<Alloc>(size, size + 1);
+
+			return ((cap < capacity) ? cap : capacity);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef IS_TRIVIALLY_COPYABLE_HPP
+# define IS_TRIVIALLY_COPYABLE_HPP
+
+# include "type_traits.hpp"
+# include "is_integral.hpp"
+
+namespace ft {
+
+	//	Trait class that identifies whether T is a trivially copyable type.
+	// A trivially copyable type can be copied with memcpy/memmove: it has no user provided copy
+	// constructor, copy assignment or destructor, so the containers are allowed to relocate
+	// and copy it as raw bytes instead of constructing elements one by one.
+
+	// the answer can only come from the compiler, C++98 has no way to inspect constructors.
+	// without builtin support only the fundamental types and pointers are reported as trivial,
+	// which is always safe (it only disables the fast path).
+
+	template <typename T>
+	struct is_fundamental_copyable : public integral_constant<bool, ft::is_integral<T>::value> {};
+
+	template <>
+	struct is_fundamental_copyable<float> : public true_type {};
+
+	template <>
+	struct is_fundamental_copyable<double> : public true_type {};
+
+	template <>
+	struct is_fundamental_copyable<long double> : public true_type {};
+
+	template <typename T>
+	struct is_fundamental_copyable<T *> : public true_type {};
+
+# if defined(__GNUC__) || defined(__clang__)
+	template <typename T>
+	struct is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)> {};
+# else
+	template <typename T>
+	struct is_trivially_copyable : public is_fundamental_copyable<T> {};
+# endif
+
+
+	//	Trait class that identifies whether T is trivially default constructible: default
+	// initializing it does nothing, so new elements can be left untouched until they are written.
+
+# if defined(__GNUC__) || defined(__clang__)
+	template <typename T>
+	struct is_trivially_default_constructible : public integral_constant<bool, __is_trivially_constructible(T)> {};
+# else
+	template <typename T>
+	struct is_trivially_default_constructible : public is_fundamental_copyable<T> {};
+# endif
+
+
+	//	Trait class that identifies whether T is trivially destructible: destroying it does
+	// nothing, so storage holding such elements can be released without visiting them.
+
+# if defined(__GNUC__) || defined(__clang__)
+	template <typename T>
+	struct is_trivially_destructible : public integral_constant<bool, __has_trivial_destructor(T)> {};
+# else
+	template <typename T>
+	struct is_trivially_destructible : public is_fundamental_copyable<T> {};
+# endif
+
+}
+
+#endif
@@ -1,19 +1,142 @@
 #ifndef ITERATOR_HPP
 # define ITERATOR_HPP
 
+# include <cstddef>
+# include <iterator>
+
 namespace ft
 {
+	//////////////////////////
+	// Iterator categories //
+	//////////////////////////
+
+	// Empty classes identifying the category of an iterator. They are the std tags so that
+	// std iterators (istream_iterator, std::vector<T>::iterator...) dispatch the same way as ours.
+	typedef std::input_iterator_tag			input_iterator_tag;
+	typedef std::output_iterator_tag		output_iterator_tag;
+	typedef std::forward_iterator_tag		forward_iterator_tag;
+	typedef std::bidirectional_iterator_tag	bidirectional_iterator_tag;
+	typedef std::random_access_iterator_tag	random_access_iterator_tag;
+
+	/////////////////////
+	// Iterator traits //
+	/////////////////////
+
+	// Uniform interface to the properties of an iterator, pointers are random access iterators.
+	template <class Iterator>
+	struct iterator_traits
+	{
+		typedef typename Iterator::difference_type		difference_type;
+		typedef typename Iterator::value_type			value_type;
+		typedef typename Iterator::pointer				pointer;
+		typedef typename Iterator::reference			reference;
+		typedef typename Iterator::iterator_category	iterator_category;
+	};
+
+	template <class T>
+	struct iterator_traits<T *>
+	{
+		typedef std::ptrdiff_t							difference_type;
+		typedef T										value_type;
+		typedef T *										pointer;
+		typedef T &										reference;
+		typedef random_access_iterator_tag				iterator_category;
+	};
+
+	template <class T>
+	struct iterator_traits<const T *>
+	{
+		typedef std::ptrdiff_t							difference_type;
+		typedef T										value_type;
+		typedef const T *								pointer;
+		typedef const T &								reference;
+		typedef random_access_iterator_tag				iterator_category;
+	};
+
+	//////////////
+	// Distance //
+	//////////////
+
+	// Number of increments from first to last: O(1) for random access iterators, one walk otherwise.
+	template <class InputIterator>
+	typename iterator_traits<InputIterator>::difference_type
+	distance (InputIterator first, InputIterator last, input_iterator_tag)
+	{
+		typename iterator_traits<InputIterator>::difference_type	n = 0;
+
+		for ( ; first != last ; ++first)
+			n++;
+		return (n);
+	}
+
+	template <class RandomAccessIterator>
+	typename iterator_traits<RandomAccessIterator>::difference_type
+	distance (RandomAccessIterator first, RandomAccessIterator last, random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	template <class InputIterator>
+	typename iterator_traits<InputIterator>::difference_type
+	distance (InputIterator first, InputIterator last)
+	{
+		return (ft::distance(first, last, typename iterator_traits<InputIterator>::iterator_category()));
+	}
+
+	/////////////
+	// Advance //
+	/////////////
+
+	// Moves it by n positions: O(1) for random access iterators, n steps otherwise
+	// (n may only be negative for bidirectional iterators).
+	template <class InputIterator, class Distance>
+	void advance (InputIterator & it, Distance n, input_iterator_tag)
+	{
+		for ( ; n > 0 ; n--)
+			++it;
+	}
+
+	template <class BidirectionalIterator, class Distance>
+	void advance (BidirectionalIterator & it, Distance n, bidirectional_iterator_tag)
+	{
+		for ( ; n > 0 ; n--)
+			++it;
+		for ( ; n < 0 ; n++)
+			--it;
+	}
+
+	template <class RandomAccessIterator, class Distance>
+	void advance (RandomAccessIterator & it, Distance n, random_access_iterator_tag)
+	{
+		it += n;
+	}
+
+	template <class InputIterator, class Distance>
+	void advance (InputIterator & it, Distance n)
+	{
+		ft::advance(it, n, typename iterator_traits<InputIterator>::iterator_category());
+	}
+
 	//////////////////////
 	// Reverse iterator //
 	//////////////////////
 
+	// like std::reverse_iterator it holds the base iterator, one past the element it refers to,
+	// so rbegin() and rend() are built from end() and begin() without stepping out of the range.
 	template <class it>
 	class reverse_iterator {
 	public:
+		// Member types
+		typedef					it													iterator_type;
+		typedef typename		iterator_traits<it>::iterator_category				iterator_category;
+		typedef typename		iterator_traits<it>::value_type						value_type;
+		typedef typename		iterator_traits<it>::difference_type				difference_type;
+		typedef typename		iterator_traits<it>::pointer						pointer;
+		typedef typename		iterator_traits<it>::reference						reference;
 		// -structors
 		reverse_iterator			(void)												{ _it = it(); }
-		reverse_iterator			(typename it::value_type * ptr)						{ _it = it(ptr); }
-		reverse_iterator			(const it & x)										{ _it = x; --_it; }
+		reverse_iterator			(const it & x)										{ _it = x; }
+		reverse_iterator			(const reverse_iterator & x)						{ _it = x.getIt(); }
 		~reverse_iterator			(void)												{}
 		// Conversion
 		template <class U>			friend class										reverse_iterator;
@@ -22,8 +145,8 @@ namespace ft
 
 		// Assignment
 		reverse_iterator &			operator=	(const reverse_iterator & x)			{ _it = x.getIt(); return (*this); }
-		reverse_iterator &			operator+=	(int n)									{ _it -= n; return (*this); }
-		reverse_iterator &			operator-=	(int n)									{ _it += n; return (*this); }
+		reverse_iterator &			operator+=	(difference_type n)						{ _it -= n; return (*this); }
+		reverse_iterator &			operator-=	(difference_type n)						{ _it += n; return (*this); }
 		// Comparison
 		template <class U> bool		operator==	(const reverse_iterator<U> & x) const	{ return (_it == x.getIt()); }
 		template <class U> bool		operator!=	(const reverse_iterator<U> & x) const	{ return (_it != x.getIt()); }
@@ -37,18 +160,18 @@ namespace ft
 		reverse_iterator			operator++	(int)									{ reverse_iterator<it> x(*this); --_it; return (x); }
 		reverse_iterator			operator--	(int)									{ reverse_iterator<it> x(*this); ++_it; return (x); }
 		// Operation
-		reverse_iterator			operator+	(int n) const							{ return (_it - n + 1); }
-		reverse_iterator			operator-	(int n) const							{ return (_it + n + 1); }
-		std::ptrdiff_t				operator-	(const reverse_iterator & x) const		{ return (x.getIt() - _it); }
+		reverse_iterator			operator+	(difference_type n) const				{ return (_it - n); }
+		reverse_iterator			operator-	(difference_type n) const				{ return (_it + n); }
+		difference_type				operator-	(const reverse_iterator & x) const		{ return (x.getIt() - _it); }
 		// Dereference
-		typename it::value_type &	operator[]	(size_t n) const						{ return (*(_it - n)); }
-		typename it::value_type &	operator*	(void) const							{ return (*_it); }
-		typename it::value_type *	operator->	(void) const							{ return (&(*_it)); }
+		reference					operator[]	(difference_type n) const				{ return (*(_it - n - 1)); }
+		reference					operator*	(void) const							{ it x(_it); return (*--x); }
+		pointer						operator->	(void) const							{ return (&(**this)); }
 		// Member functions
-		it							base		(void)									{ return (++it(_it)); }
+		it							base		(void) const							{ return (_it); }
 		it							getIt		(void) const							{ return (_it); }
 		// Non-member functions
-		friend reverse_iterator		operator+	(int n, const reverse_iterator & x)		{ return (x.getIt() - n + 1); }
+		friend reverse_iterator		operator+	(difference_type n, const reverse_iterator & x)	{ return (x.getIt() - n); }
 
 	private:
 		it		_it;
@@ -0,0 +1,159 @@
+#ifndef MMAP_ALLOCATOR_HPP
+# define MMAP_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <new>
+# include <limits>
+# include <sys/mman.h>
+# include "growth_policy.hpp"
+
+namespace ft
+{
+	////////////////////
+	// Mmap allocator //
+	////////////////////
+
+	// Allocator handing out anonymous private mappings, meant for huge vectors.
+	// Blocks are whole pages (2MB huge pages when HugePages is set), allocate(0) returns NULL.
+	// On linux reallocate() grows a block with mremap: the kernel moves the page tables,
+	// not the data, so the vector grows without a copy and without holding both buffers.
+	// Only types that can be relocated as raw bytes can go through reallocate(),
+	// ft::vector checks it with ft::is_trivially_copyable.
+
+	template <class T, bool HugePages = false>
+	class mmap_allocator {
+	public:
+		typedef		T					value_type;
+		typedef		T *					pointer;
+		typedef		const T *			const_pointer;
+		typedef		T &					reference;
+		typedef		const T &			const_reference;
+		typedef		std::size_t			size_type;
+		typedef		std::ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind { typedef mmap_allocator<U, HugePages> other; };
+
+		mmap_allocator			(void)										{}
+		mmap_allocator			(const mmap_allocator &)					{}
+		template <class U>
+		mmap_allocator			(const mmap_allocator<U, HugePages> &)		{}
+		~mmap_allocator			(void)										{}
+		mmap_allocator &		operator=	(const mmap_allocator &)			{ return (*this); }
+
+		pointer			address		(reference x) const						{ return (&x); }
+		const_pointer	address		(const_reference x) const				{ return (&x); }
+		size_type		max_size	(void) const							{ return (std::numeric_limits<size_type>::max() / sizeof(T)); }
+
+		// granularity of the mappings in bytes.
+		static size_type block (void)
+		{
+			return (HugePages ? 2 * 1024 * 1024 : 4096);
+		}
+
+		// size in bytes of the mapping holding n elements, bad_alloc when it does not fit in size_type.
+		static size_type bytes (size_type n)
+		{
+			if (n > (std::numeric_limits<size_type>::max() - (block() - 1)) / sizeof(T))
+				throw std::bad_alloc();
+			return (((n * sizeof(T) + block() - 1) / block()) * block());
+		}
+
+		pointer allocate (size_type n, const void * = 0)
+		{
+			if (n == 0)
+				return (NULL);
+			if (n > this->max_size())
+				throw std::bad_alloc();
+
+			void *	p = mmap(NULL, bytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (p == MAP_FAILED)
+				throw std::bad_alloc();
+			this->_advise(p, bytes(n));
+			return (static_cast<pointer>(p));
+		}
+
+		void deallocate (pointer p, size_type n)
+		{
+			if (p)
+				munmap(p, bytes(n));
+		}
+
+		// resize the block p of old_n elements to new_n elements, the content is kept
+		// as raw bytes. The block is grown in place or moved by the kernel when possible.
+		pointer reallocate (pointer p, size_type old_n, size_type new_n)
+		{
+			if (p == NULL)
+				return (this->allocate(new_n));
+			if (new_n == 0)
+			{
+				this->deallocate(p, old_n);
+				return (NULL);
+			}
+			if (bytes(old_n) == bytes(new_n))
+				return (p);
+			if (new_n > this->max_size())
+				throw std::bad_alloc();
+# ifdef __linux__
+			void *	q = mremap(p, bytes(old_n), bytes(new_n), MREMAP_MAYMOVE);
+
+			if (q == MAP_FAILED)
+				throw std::bad_alloc();
+			if (new_n > old_n)
+				this->_advise(q, bytes(new_n));
+			return (static_cast<pointer>(q));
+# else
+			pointer		q = this->allocate(new_n);
+
+			std::memcpy(static_cast<void *>(q), static_cast<const void *>(p), ((old_n < new_n) ? old_n : new_n) * sizeof(T));
+			this->deallocate(p, old_n);
+			return (q);
+# endif
+		}
+
+# ifdef FT_CXX11_
+		template <class U, class... Args>
+		void			construct	(U * p, Args &&... args)				{ ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+# else
+		void			construct	(pointer p, const_reference val)		{ ::new (static_cast<void *>(p)) T(val); }
+# endif
+		void			destroy		(pointer p)								{ p->~T(); }
+
+	private:
+		// transparent huge pages hint, ignored by kernels without THP.
+		void _advise (void * p, size_type len) const
+		{
+# ifdef MADV_HUGEPAGE
+			if (HugePages)
+				madvise(p, len, MADV_HUGEPAGE);
+# else
+			(void)p;
+			(void)len;
+# endif
+		}
+	};
+
+	// stateless, any two mmap allocators can release each other's blocks.
+	template <class T, class U, bool H>
+	bool operator== (const mmap_allocator<T, H> &, const mmap_allocator<U, H> &) { return (true); }
+
+	template <class T, class U, bool H>
+	bool operator!= (const mmap_allocator<T, H> &, const mmap_allocator<U, H> &) { return (false); }
+
+	template <class T, bool HugePages>
+	struct can_reallocate< mmap_allocator<T, HugePages> > : public true_type {};
+
+	template <class T, bool HugePages>
+	struct usable_size< mmap_allocator<T, HugePages> >
+	{
+		static std::size_t bytes (std::size_t n)
+		{
+			std::size_t		block = mmap_allocator<T, HugePages>::block();
+			return (((n + block - 1) / block) * block);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,283 @@
+#ifndef NODE_POOL_HPP
+# define NODE_POOL_HPP
+
+# include <cstddef>
+# include <new>
+# include <limits>
+# include "type_traits.hpp"
+
+namespace ft
+{
+	///////////////
+	// Node pool //
+	///////////////
+
+	// Allocator carving single objects out of large slabs, meant for the nodes of ft::map.
+	// allocate(1) takes a freed slot or the next slot of the current slab, deallocate(p, 1)
+	// pushes p on a free list: no call reaches the heap once the slabs are there, and nodes
+	// allocated one after the other are neighbours in memory. Slabs double in size up to
+	// max_slab slots and are only given back when the last allocator sharing them is gone.
+	// Copies share the same pool (and compare equal), rebinding to another type starts an
+	// empty one. The pool is not thread safe. Requests of more than one object go to the heap.
+
+	template <class T>
+	class node_pool {
+	public:
+		typedef		T					value_type;
+		typedef		T *					pointer;
+		typedef		const T *			const_pointer;
+		typedef		T &					reference;
+		typedef		const T &			const_reference;
+		typedef		std::size_t			size_type;
+		typedef		std::ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind { typedef node_pool<U> other; };
+
+		// slots of the first slab, and of the largest ones.
+		static const size_type	min_slab = 16;
+		static const size_type	max_slab = 16384;
+
+		node_pool				(void)								: _pool(NULL) {}
+		node_pool				(const node_pool & x)				: _pool(x._pool) { this->_retain(); }
+		template <class U>
+		node_pool				(const node_pool<U> &)				: _pool(NULL) {}
+		~node_pool				(void)								{ this->_release(); }
+
+		node_pool & operator= (const node_pool & x)
+		{
+			if (_pool != x._pool)
+			{
+				this->_release();
+				_pool = x._pool;
+				this->_retain();
+			}
+			return (*this);
+		}
+
+		pointer			address		(reference x) const				{ return (&x); }
+		const_pointer	address		(const_reference x) const		{ return (&x); }
+		size_type		max_size	(void) const					{ return (std::numeric_limits<size_type>::max() / sizeof(T)); }
+
+		pointer allocate (size_type n, const void * = 0)
+		{
+			if (n != 1)
+			{
+				if (n > this->max_size())
+					throw std::bad_alloc();
+				return (static_cast<pointer>(::operator new(n * sizeof(T))));
+			}
+			if (_pool == NULL)
+				_pool = new pool;
+
+			slot *	p = _pool->free;
+
+			if (p != NULL)
+			{
+				_pool->free = p->next;
+				_pool->free_count--;
+			}
+			else
+			{
+				if (_pool->next == _pool->end)
+					this->_add_slab(_pool->slab_size);
+				p = reinterpret_cast<slot *>(_pool->next);
+				_pool->next += stride;
+			}
+			return (reinterpret_cast<pointer>(p));
+		}
+
+		void deallocate (pointer p, size_type n)
+		{
+			if (n != 1)
+			{
+				::operator delete(p);
+				return ;
+			}
+
+			slot *	s = reinterpret_cast<slot *>(p);
+
+			s->next = _pool->free;
+			_pool->free = s;
+			_pool->free_count++;
+		}
+
+		// makes sure the next n allocate(1) are served without a new slab.
+		void reserve (size_type n)
+		{
+			if (_pool == NULL)
+				_pool = new pool;
+
+			size_type	available = _pool->free_count + (_pool->end - _pool->next) / stride;
+
+			if (available < n)
+			{
+				// the rest of the current slab goes on the free list, so the new one is used from its start.
+				while (_pool->next != _pool->end)
+				{
+					this->deallocate(reinterpret_cast<pointer>(_pool->next), 1);
+					_pool->next += stride;
+				}
+				this->_add_slab(n - _pool->free_count);
+			}
+		}
+
+		// tells whether this allocator is the only one using its pool: nodes are then
+		// released all at once with it and need not be deallocated one by one.
+		bool unique (void) const
+		{
+			return (_pool == NULL || _pool->refs == 1);
+		}
+
+		// gives back every slot at once except keep, which must come from this pool, without
+		// destroying the objects in them. Only for an allocator using its pool alone. The slab
+		// holding keep stays and is handed out again from its start, the other slabs are freed.
+		void reset (pointer keep)
+		{
+			char *		k = reinterpret_cast<char *>(keep);
+			slab *		kept = NULL;
+
+			while (_pool->slabs != NULL)
+			{
+				slab *	next = _pool->slabs->next;
+				char *	first = reinterpret_cast<char *>(_pool->slabs) + header;
+
+				if (k >= first && k < first + _pool->slabs->size * stride)
+					kept = _pool->slabs;
+				else
+					::operator delete(_pool->slabs);
+				_pool->slabs = next;
+			}
+			kept->next = NULL;
+			_pool->slabs = kept;
+			_pool->free = NULL;
+			_pool->free_count = 0;
+
+			char *		first = reinterpret_cast<char *>(kept) + header;
+
+			// the slots before keep go on the free list, there are none when keep came first.
+			for (char * p = first ; p != k ; p += stride)
+				this->deallocate(reinterpret_cast<pointer>(p), 1);
+			_pool->next = k + stride;
+			_pool->end = first + kept->size * stride;
+		}
+
+		template <class U>
+		bool same_pool (const node_pool<U> & x) const
+		{
+			return (static_cast<const void *>(_pool) == static_cast<const void *>(x._pool));
+		}
+
+# ifdef FT_CXX11_
+		template <class U, class... Args>
+		void			construct	(U * p, Args &&... args)		{ ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+# else
+		void			construct	(pointer p, const_reference val){ ::new (static_cast<void *>(p)) T(val); }
+# endif
+		void			destroy		(pointer p)						{ p->~T(); }
+
+	private:
+		template <class U>
+		friend class node_pool;
+
+		// a free slot holds the next free one.
+		struct slot
+		{
+			slot *		next;
+		};
+
+		// start of a slab: the next slab and the number of slots.
+		struct slab
+		{
+			slab *		next;
+			size_type	size;
+		};
+
+		// distance between two slots: large enough for a free list link, and a multiple
+		// of the alignment of T since sizeof(T) is.
+		static const size_type	stride = (sizeof(T) + sizeof(slot) - 1) / sizeof(slot) * sizeof(slot);
+		// bytes taken by the slab header, a whole number of slots.
+		static const size_type	header = (sizeof(slab) + stride - 1) / stride * stride;
+
+		// state shared by the copies of an allocator. Slabs are chained through their
+		// header, the slots are handed out from next to end.
+		struct pool
+		{
+			size_type	refs;
+			slot *		free;
+			size_type	free_count;
+			char *		next;
+			char *		end;
+			slab *		slabs;
+			size_type	slab_size;
+
+			pool (void) : refs(1), free(NULL), free_count(0), next(NULL), end(NULL), slabs(NULL), slab_size(min_slab) {}
+		};
+
+		pool *		_pool;
+
+		// allocates a slab of n slots (at least the current slab size) and makes it current.
+		void _add_slab (size_type n)
+		{
+			if (n < _pool->slab_size)
+				n = _pool->slab_size;
+			if (n > (std::numeric_limits<size_type>::max() - header) / stride)
+				throw std::bad_alloc();
+
+			char *	mem = static_cast<char *>(::operator new(header + n * stride));
+			slab *	head = reinterpret_cast<slab *>(mem);
+
+			head->next = _pool->slabs;
+			head->size = n;
+			_pool->slabs = head;
+			_pool->next = mem + header;
+			_pool->end = mem + header + n * stride;
+			if (_pool->slab_size < max_slab)
+				_pool->slab_size *= 2;
+		}
+
+		void _retain (void)
+		{
+			if (_pool != NULL)
+				_pool->refs++;
+		}
+
+		// drops this allocator from its pool, the last one frees the slabs.
+		void _release (void)
+		{
+			if (_pool == NULL || --_pool->refs != 0)
+				return ;
+			while (_pool->slabs != NULL)
+			{
+				slab *	next = _pool->slabs->next;
+
+				::operator delete(_pool->slabs);
+				_pool->slabs = next;
+			}
+			delete _pool;
+			_pool = NULL;
+		}
+	};
+
+	// copies share their pool and can release each other's nodes.
+	template <class T, class U>
+	bool operator== (const node_pool<T> & x, const node_pool<U> & y) { return (x.same_pool(y)); }
+
+	template <class T, class U>
+	bool operator!= (const node_pool<T> & x, const node_pool<U> & y) { return (!x.same_pool(y)); }
+
+	/////////////////
+	// Can reserve //
+	/////////////////
+
+	// Tells whether Alloc has a reserve(n) member setting aside room for n single
+	// allocations, which ft::map::reserve forwards to. Specialize it for other such allocators.
+
+	template <class Alloc>
+	struct can_reserve : public false_type {};
+
+	template <class T>
+	struct can_reserve< node_pool<T> > : public true_type {};
+}
+
+#endif
@@ -3,6 +3,27 @@
 
 namespace ft
 {
+	///////////////////////
+	// Integral constant //
+	///////////////////////
+
+	// Wraps a static constant of specified type. It is the base class for the type traits
+	// and lets functions be overloaded on a trait result (tag dispatching).
+
+	template <class T, T v>
+	struct integral_constant
+	{
+		typedef T							value_type;
+		typedef integral_constant<T, v>		type;
+		static const T						value = v;
+	};
+
+	template <class T, T v>
+	const T integral_constant<T, v>::value;
+
+	typedef integral_constant<bool, true>	true_type;
+	typedef integral_constant<bool, false>	false_type;
+
 	///////////////
 	// Enable If //
 	///////////////
@@ -50,6 +71,18 @@ namespace ft
 
 	template <class T, class U>
 	struct conditional<false, T, U> { typedef U type; };
+
+	//////////////////
+	// Remove const //
+	//////////////////
+
+	// Provides member typedef type, which is T without its top-level const qualifier.
+
+	template <class T>
+	struct remove_const { typedef T type; };
+
+	template <class T>
+	struct remove_const<const T> { typedef T type; };
 }
 
 #endif
@@ -1,6 +1,8 @@
 #ifndef UTILITY_HPP
 # define UTILITY_HPP
 
+# include <algorithm>
+
 namespace ft
 {
 	//////////
@@ -63,6 +65,24 @@ namespace ft
 		b = tmp;
 	}
 
+	// more specialized than both ft::swap and std::swap, so std algorithms swapping ft pairs
+	// (sort, rotate...) are not ambiguous. The members use the best swap found for their type.
+	template <class T1, class T2>
+	void swap (pair<T1,T2> & x, pair<T1,T2> & y)
+	{
+		using std::swap;
+		swap(x.first, y.first);
+		swap(x.second, y.second);
+	}
+
+	///////////////////
+	// Sorted unique //
+	///////////////////
+
+	// Tag telling a range operation that its input is sorted by key without duplicates.
+	struct sorted_unique_t {};
+	static const sorted_unique_t	sorted_unique = sorted_unique_t();
+
 	///////////////
 	// To string //
 	///////////////
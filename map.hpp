@@ -2,6 +2,10 @@
 # define MAP_HPP
 
 # include "includes/containers.hpp"
+# include "includes/node_pool.hpp"
+# ifdef FT_DEBUG
+#  include <cassert>
+# endif
 // #include <chrono>
 // #include <thread>
 // red-black binary search tree map implementation :
@@ -11,11 +15,50 @@
 // 4. all paths from a node to its NIL descendants
 //    contain the same number of black nodes
 // 5. items to the left are always smaller
-// 
+//
+// _nil is the sentinel every leaf points to and the end() node: its right is the
+// root, its left the first node and its parent the last one (itself when empty),
+// so begin(), --end() and the hints at either end never walk down the tree.
+// As its links are all taken, _nil is told apart by a mark of its own: iterators
+// are a single node pointer and test the mark of the node they step to.
+//
+// built with FT_MAP_ORDER_STATISTICS every node also stores the size of its
+// subtree, kept up to date by insertions, removals and rotations, which gives
+// select / rank / count_range and iterator positions in O(log n).
+//
+// built with FT_MAP_COMPACT_NODES the color of a node is stored in the low bit of
+// its parent pointer instead of a separate bool, which saves the padding word the
+// bool costs: a map<int, int> node goes from 40 to 32 bytes.
 
 namespace ft
 {
 
+# ifdef FT_MAP_COMPACT_NODES
+	// pointer to a node carrying two more bits in its low bits, which are always 0 in
+	// the address of a node. It reads and is assigned like a plain node pointer:
+	// assigning only replaces the address and keeps the bits, copying takes them.
+	template <class Node>
+	class tagged_link {
+	public:
+		tagged_link		(void)								: _bits(0) {}
+		tagged_link		(const tagged_link & x)				: _bits(x._bits) {}
+
+		tagged_link &	operator=	(Node * ptr)			{ _bits = reinterpret_cast<std::size_t>(ptr) | (_bits & 3); return (*this); }
+		tagged_link &	operator=	(const tagged_link & x)	{ return (*this = x.get()); }
+						operator	Node * (void) const		{ return (this->get()); }
+		Node *			operator->	(void) const			{ return (this->get()); }
+
+		Node *			get			(void) const			{ return (reinterpret_cast<Node *>(_bits & ~static_cast<std::size_t>(3))); }
+		bool			bit			(void) const			{ return (_bits & 1); }
+		void			set_bit		(bool b)				{ _bits = (_bits & ~static_cast<std::size_t>(1)) | b; }
+		bool			mark		(void) const			{ return (_bits & 2); }
+		void			set_mark	(void)					{ _bits |= 2; }
+
+	private:
+		std::size_t		_bits;
+	};
+# endif
+
 template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key, T> > >
 class map {
 public:
@@ -29,12 +72,35 @@ public:
 		ft::pair<const Key, T>	data;
 		struct s_node *			left;
 		struct s_node *			right;
+# ifdef FT_MAP_COMPACT_NODES
+		tagged_link<s_node>		parent;	// the color is the low bit, the sentinel mark the next one
+# else
 		struct s_node *			parent;
-		bool					color;
-
+		bool					red;
+		bool					sentinel;	// true for _nil only, fits in the padding after red
+# endif
+# ifdef FT_MAP_ORDER_STATISTICS
+		std::size_t				count;	// nodes in the subtree rooted here, 0 for _nil
+# endif
+
+# ifdef FT_MAP_COMPACT_NODES
 		s_node (ft::pair<const Key, T> data) : data(data) {}
+# else
+		s_node (ft::pair<const Key, T> data) : data(data), sentinel(false) {}
+# endif
 		const Key &	key (void)	{ return (data.first); }
 		T &			val (void)	{ return (data.second); }
+# ifdef FT_MAP_COMPACT_NODES
+		bool		color (void) const			{ return (parent.bit()); }
+		void		set_color (bool color)		{ parent.set_bit(color); }
+		bool		is_sentinel (void) const	{ return (parent.mark()); }
+		void		set_sentinel (void)			{ parent.set_mark(); }
+# else
+		bool		color (void) const			{ return (red); }
+		void		set_color (bool color)		{ red = color; }
+		bool		is_sentinel (void) const	{ return (sentinel); }
+		void		set_sentinel (void)			{ sentinel = true; }
+# endif
 	}							node;
 
 	///////////////////////
@@ -50,9 +116,13 @@ public:
 		typedef typename		ft::conditional<IsConst, const node, node>::type			node_type;
 		typedef					std::ptrdiff_t												difference_type;
 		typedef					std::size_t													size_type;
+		typedef					value_type *												pointer;
+		typedef					value_type &												reference;
+		typedef					ft::bidirectional_iterator_tag								iterator_category;
 		// -structors
 		mapIterator				(void)														{ _ptr = NULL; }
 		mapIterator				(node_type * const ptr)										{ _ptr = ptr; }
+		mapIterator				(const mapIterator & x)										{ _ptr = x.getPtr(); }
 		~mapIterator			(void)														{}
 		// Const stuff
 		template <bool B>		mapIterator
@@ -80,39 +150,46 @@ public:
 		// get next node pointer in binary tree
 		void nextNode (void)
 		{
-			if (_ptr->right != _ptr->right->left)
+			if (!_ptr->right->is_sentinel())
 			{
 				_ptr = _ptr->right;
-				while (_ptr->left != _ptr->left->left)
-						_ptr = _ptr->left;
+				while (!_ptr->left->is_sentinel())
+					_ptr = _ptr->left;
 			}
 			else
 			{
-				while (_ptr == _ptr->parent->right && _ptr != _ptr->parent)
-					_ptr = _ptr->parent;
-				_ptr = _ptr->parent;
+				node_type *	parent = _ptr->parent;
+
+				while (!parent->is_sentinel() && _ptr == parent->right)
+				{
+					_ptr = parent;
+					parent = parent->parent;
+				}
+				_ptr = parent;
 			}
 		}
 
-		// get previous node pointer in binary tree
+		// get previous node pointer in binary tree, end() steps back to the rightmost node kept by _nil.
 		void prevNode (void)
 		{
-			if (_ptr == _ptr->parent)
-			{
-				while (_ptr->right != _ptr->right->left)
-					_ptr = _ptr->right;
-			}
-			else if (_ptr->left != _ptr->left->left)
+			if (_ptr->is_sentinel())
+				_ptr = _ptr->parent;
+			else if (!_ptr->left->is_sentinel())
 			{
 				_ptr = _ptr->left;
-				while (_ptr->right != _ptr->right->left)
+				while (!_ptr->right->is_sentinel())
 					_ptr = _ptr->right;
 			}
 			else
 			{
-				while (_ptr == _ptr->parent->left && _ptr != _ptr->parent)
-					_ptr = _ptr->parent;
-				_ptr = _ptr->parent;
+				node_type *	parent = _ptr->parent;
+
+				while (!parent->is_sentinel() && _ptr == parent->left)
+				{
+					_ptr = parent;
+					parent = parent->parent;
+				}
+				_ptr = parent;
 			}
 		}
 	}; // Iterator
@@ -157,6 +234,78 @@ public:
 		Compare			comp;
 	};
 
+	/////////////////
+	// Node handle //
+	/////////////////
+
+	// Owns a node taken out of a map by extract(): it goes back into a map (this one, maybe
+	// with another key, or another one with an equal allocator) with insert(), without
+	// reallocating or copying the element. C++98 has no move: like std::auto_ptr, copying
+	// a handle takes its node, which leaves the source empty. A handle still owning a node
+	// destroys it.
+	class node_handle {
+	public:
+		typedef		Key					key_type;
+		typedef		T					mapped_type;
+		typedef		typename map::allocator_type	allocator_type;
+
+		node_handle		(void)								: _ptr(NULL) {}
+		node_handle		(const node_handle & x)				: _ptr(x._ptr), _alloc(x._alloc) { x._ptr = NULL; }
+		~node_handle	(void)								{ this->_release(); }
+
+		node_handle & operator= (const node_handle & x)
+		{
+			if (this != &x)
+			{
+				this->_release();
+				_ptr = x._ptr;
+				_alloc = x._alloc;
+				x._ptr = NULL;
+			}
+			return (*this);
+		}
+
+		bool			empty			(void) const		{ return (_ptr == NULL); }
+		// the key can be changed while the node is out of any map.
+		key_type &		key				(void) const		{ return (const_cast<key_type &>(_ptr->data.first)); }
+		mapped_type &	mapped			(void) const		{ return (_ptr->data.second); }
+		allocator_type	get_allocator	(void) const		{ return (_alloc); }
+
+		void swap (node_handle & x)
+		{
+			ft::swap(_ptr, x._ptr);
+			ft::swap(_alloc, x._alloc);
+		}
+
+	private:
+		friend			class			map;
+
+		node_handle		(node * ptr, const allocator_type & alloc)	: _ptr(ptr), _alloc(alloc) {}
+
+		void _release (void)
+		{
+			if (_ptr == NULL)
+				return ;
+			_alloc.destroy(_ptr);
+			_alloc.deallocate(_ptr, 1);
+			_ptr = NULL;
+		}
+
+		mutable node *	_ptr;
+		allocator_type	_alloc;
+	};
+
+	typedef		node_handle										node_type;
+
+	// what insert(node_type) returns: where the key is, whether the node went in, and
+	// the node itself when the key was already there.
+	struct insert_return_type
+	{
+		iterator		position;
+		bool			inserted;
+		node_type		node;
+	};
+
 	//////////////////
 	// Constructors //
 	//////////////////
@@ -166,6 +315,7 @@ public:
 	{
 		_alloc = alloc;
 		_comp = comp;
+		_size = 0;
 		this->_new_nil_node();
 	}
 
@@ -177,17 +327,58 @@ public:
 	{
 		_alloc = alloc;
 		_comp = comp;
+		_size = 0;
 		this->_new_nil_node();
+		try
+		{
+			this->insert(first, last);
+		}
+		catch (...)
+		{
+			this->clear();
+			this->_delete_nil_node();
+			throw;
+		}
+	}
 
-		while (first != last)
-			this->insert(*first++);
+	//	Constructs a container from the range [first,last), which has to be sorted by key
+	//	without duplicates: the tree is built balanced in one pass, in linear time.
+	template <class InputIterator>
+	map (sorted_unique_t, InputIterator first, InputIterator last, const key_compare & comp = key_compare(),
+	const allocator_type & alloc = allocator_type())
+	{
+		_alloc = alloc;
+		_comp = comp;
+		_size = 0;
+		this->_new_nil_node();
+		try
+		{
+			this->insert(sorted_unique, first, last);
+		}
+		catch (...)
+		{
+			this->_delete_nil_node();
+			throw;
+		}
 	}
 
 	//	Constructs a container with a copy of each of the elements in x.
+	//	No destructor runs when a copy throws: the end node is freed here.
 	map (const map & x)
 	{
+		_alloc = x._alloc;
+		_comp = x._comp;
+		_size = 0;
 		this->_new_nil_node();
-		*this = x;
+		try
+		{
+			*this = x;
+		}
+		catch (...)
+		{
+			this->_delete_nil_node();
+			throw;
+		}
 	}
 
 	/////////////////
@@ -196,11 +387,13 @@ public:
 
 	// This destroys all container elements, and deallocates all the storage 
 	//	capacity allocated by the map container using its allocator.
+	// With an ft::node_pool used by this map alone and elements with nothing to destroy,
+	//	the nodes are not visited: the slabs are freed all at once with the allocator.
 	~map (void)
 	{
-		this->clear();
-		_alloc.destroy(_nil);
-		_alloc.deallocate(_nil, 1);
+		if (!this->_pool_releases_nodes(ft::can_reserve<allocator_type>()))
+			this->clear();
+		this->_delete_nil_node();
 	}
 
 	/////////////////////////
@@ -209,17 +402,34 @@ public:
 
 	// Copies all the elements from x into the container, changing its size accordingly.
 	// The container preserves its current allocator, which is used to allocate additional storage if needed.
+	// x is already a valid red-black tree: its shape and colors are cloned in O(n) without a
+	// comparison, and the nodes the container already has are reused before allocating new ones.
+	// The clone grows apart from the container: when a copy throws, the part already cloned
+	// and the nodes not reused yet are freed and the container is left empty.
 	map & operator= (const map & x)
 	{
 		if (this == &x)
 			return (*this);
 
-		this->clear();
-		_alloc = x._alloc;
-		_comp = x._comp;
+		node *	spare = this->_detach_nodes();
+		node *	root = _nil;
 
-		for (const_iterator it = x.begin() ; it != x.end() ; it++)
-			this->insert(*it);
+		try
+		{
+			if (x._nil->right != x._nil)
+				this->_clone(x._nil->right, x._nil, _nil, root, spare);
+		}
+		catch (...)
+		{
+			this->_destroy_subtree(root);
+			this->_free_nodes(spare);
+			throw;
+		}
+		_comp = x._comp;
+		_nil->right = root;
+		this->_update_ends();
+		_size = x._size;
+		this->_free_nodes(spare);
 		return (*this);
 	}
 
@@ -230,12 +440,12 @@ public:
 	// Returns an iterator referring to the first element in the map container.
 	iterator begin (void)
 	{
-		return (iterator(this->_leftmost(_nil->right)));
+		return (iterator(_nil->left));
 	}
 
 	const_iterator begin (void) const
 	{
-		return (const_iterator(this->_leftmost(_nil->right)));
+		return (const_iterator(_nil->left));
 	}
 
 	// Returns an iterator referring to the past-the-end element in the map container.
@@ -257,24 +467,24 @@ public:
 	//	(i.e., its reverse beginning).
 	reverse_iterator rbegin (void)
 	{
-		return (reverse_iterator(_nil));
+		return (reverse_iterator(this->end()));
 	}
 
 	const_reverse_iterator rbegin (void) const
 	{
-		return (const_reverse_iterator(_nil));
+		return (const_reverse_iterator(this->end()));
 	}
 
 	// Returns a reverse iterator pointing to the theoretical element right before the first element
 	// in the map container (which is considered its reverse end).
 	reverse_iterator rend (void)
 	{
-		return (reverse_iterator(this->_leftmost(_nil->right)));
+		return (reverse_iterator(this->begin()));
 	}
 
 	const_reverse_iterator rend (void) const
 	{
-		return (const_reverse_iterator(this->_leftmost(_nil->right)));
+		return (const_reverse_iterator(this->begin()));
 	}
 
 	//////////////
@@ -284,16 +494,20 @@ public:
 	// Returns whether the map container is empty (i.e. whether its size is 0).
 	bool empty (void) const
 	{
-		return (_nil == _nil->right);
+		return (_size == 0);
 	}
 
-	// Returns the number of elements in the map container.
+	// Returns the number of elements in the map container, kept up to date by every insertion and removal.
+	// Built with FT_DEBUG the elements are recounted on each call to check it.
 	size_type size (void) const
 	{
+# ifdef FT_DEBUG
 		size_type n = 0;
 		for (const_iterator it = this->begin() ; it != this->end() ; it++)
 			n++;
-		return (n);
+		assert(n == _size);
+# endif
+		return (_size);
 	}
 
 	// Returns the maximum number of elements that the map container can hold.
@@ -302,16 +516,30 @@ public:
 		return (_alloc.max_size());
 	}
 
+	// Sets aside room for n elements in the allocator when it keeps nodes ahead (ft::node_pool),
+	//	so the insertions up to that size do not go through the heap and get neighbouring nodes.
+	//	Does nothing with other allocators.
+	void reserve (size_type n)
+	{
+		this->_reserve(n, ft::can_reserve<allocator_type>());
+	}
+
 	///////////////////
 	// Member access //
 	///////////////////
 
 	// If k matches the key of an element in the container, the function returns a 
-	// reference to its mapped value.
+	// reference to its mapped value, otherwise k is inserted with a default mapped value
+	// where the same descent stopped.
 	mapped_type & operator[] (const key_type & k)
 	{
-		this->insert(ft::make_pair(k, mapped_type()));
-		return (this->find(k)->second);
+		node *	parent;
+		bool	left;
+		node *	found = this->_locate(k, parent, left);
+
+		if (found == _nil)
+			found = this->_new_node(value_type(k, mapped_type()), parent, left);
+		return (found->val());
 	}
 
 	/////////////////////////
@@ -322,35 +550,197 @@ public:
 	//	the number of elements inserted.
 	ft::pair<iterator,bool> insert (const value_type & val)
 	{
-		iterator it;
-		if (this->count(val.first))
-		{
-			it = this->find(val.first);
-			return (ft::make_pair(it, false));
-		}
-		else
-		{
-			it = iterator(this->_new_node(val));
-			return (ft::make_pair(it, true));
-		}
+		node *	parent;
+		bool	left;
+		node *	found = this->_locate(val.first, parent, left);
 
+		if (found != _nil)
+			return (ft::make_pair(iterator(found), false));
+		return (ft::make_pair(iterator(this->_new_node(val, parent, left)), true));
 	}
 
 	// The function optimizes its insertion time if position points to the element that 
-	//	will precede the inserted element.
+	//	will precede or follow the inserted element: the node is hung next to position
+	//	without searching the tree, otherwise it falls back to a normal insertion.
 	iterator insert (iterator position, const value_type & val)
 	{
-		(void)position;
+		node *	parent;
+		bool	left;
+
+		if (this->_hint_parent(position.getPtr(), val.first, parent, left))
+			return (iterator(this->_new_node(val, parent, left)));
 		return (this->insert(val).first);
 	}
 
 	// Copies of the elements in the range [first,last) are inserted in the container.
+	// An empty container takes the sorted prefix of the range (keys strictly increasing)
+	// in one balanced build, the prefix nodes are freed if a copy throws. The rest is hinted
+	// at the end: the rightmost node is followed along, so an element going after every key
+	// is hung under it with one comparison.
 	template <class InputIterator>
 	void insert (InputIterator first, InputIterator last,
 	typename ft::enable_if<!ft::is_same<InputIterator, int>::value>::type* = 0)
 	{
-		while (first != last)
-			this->insert(*first++);
+		if (_nil->right == _nil)
+		{
+			node *		head = _nil;
+			node *		tail = _nil;
+			size_type	n = 0;
+
+			try
+			{
+				for ( ; first != last && (tail == _nil || _comp(tail->key(), (*first).first)) ; ++first, n++)
+					this->_append(head, tail, this->_make_node(*first));
+			}
+			catch (...)
+			{
+				this->_free_nodes(head);
+				throw;
+			}
+			this->_build(head, n);
+		}
+
+		node *	max = _nil->parent;
+
+		for ( ; first != last ; ++first)
+		{
+			const value_type &	val = *first;
+
+			if (max == _nil || _comp(max->key(), val.first))
+				max = this->_new_node(val, max, false);
+			else
+				this->insert(val);
+		}
+	}
+
+	// Merges the range [first,last), sorted by key without duplicates, into the container
+	// in O(size() + n), a key already there keeps its element as with insert. The new
+	// elements are first copied into a list of their own while the tree is walked in key
+	// order, each new node noting in its parent link the node it goes before: a copy that
+	// throws only frees that list and leaves the container untouched. The two lists are then
+	// interleaved without comparing again and the tree is rebuilt balanced.
+	// No node already in the container is reallocated.
+	template <class InputIterator>
+	void insert (sorted_unique_t, InputIterator first, InputIterator last)
+	{
+		node *		old = _nil->left;
+		node *		fresh = _nil;
+		node *		tail = _nil;
+		size_type	n = _size;
+
+		try
+		{
+			for ( ; first != last ; ++first)
+			{
+				while (old != _nil && _comp(old->key(), (*first).first))
+					old = (++iterator(old)).getPtr();
+				if (old != _nil && !_comp((*first).first, old->key()))
+					continue ;
+
+				node *	current = this->_make_node(*first);
+
+				current->parent = old;
+				this->_append(fresh, tail, current);
+				n++;
+			}
+		}
+		catch (...)
+		{
+			this->_free_nodes(fresh);
+			throw;
+		}
+		if (fresh == _nil)
+			return ;
+
+		node *		head = _nil;
+
+		old = this->_unlink_in_order();
+		tail = _nil;
+		while (old != _nil || fresh != _nil)
+		{
+			node *	current = (fresh != _nil && fresh->parent == old) ? fresh : old;
+
+			if (current == fresh)
+				fresh = fresh->right;
+			else
+				old = old->right;
+			this->_append(head, tail, current);
+		}
+		this->_build(head, n);
+	}
+
+	// Inserts the node owned by nh, which is left empty, unless its key is already in the
+	// container: the node then moves to the node member of the result. Nothing is allocated.
+	insert_return_type insert (const node_type & nh)
+	{
+		insert_return_type	ret;
+
+		ret.position = this->end();
+		ret.inserted = false;
+		if (nh.empty())
+			return (ret);
+
+		node *	parent;
+		bool	left;
+		node *	found = this->_locate(nh.key(), parent, left);
+
+		if (found != _nil)
+		{
+			ret.position = iterator(found);
+			ret.node = nh;
+			return (ret);
+		}
+		ret.position = iterator(this->_adopt(nh, parent, left));
+		ret.inserted = true;
+		return (ret);
+	}
+
+	// Same with a hint, as for insert(position, val). When the key is already there
+	// nh keeps its node.
+	iterator insert (iterator position, const node_type & nh)
+	{
+		node *	parent;
+		bool	left;
+
+		if (nh.empty())
+			return (this->end());
+		if (this->_hint_parent(position.getPtr(), nh.key(), parent, left))
+			return (iterator(this->_adopt(nh, parent, left)));
+
+		node *	found = this->_locate(nh.key(), parent, left);
+
+		if (found != _nil)
+			return (iterator(found));
+		return (iterator(this->_adopt(nh, parent, left)));
+	}
+
+	// Moves into the container every node of source whose key it does not hold yet, in
+	// key order: the nodes are unlinked from one tree and relinked in the other, nothing
+	// is allocated or copied. The elements whose key is already there stay in source.
+	// Both containers must use equal allocators.
+	void merge (map & source)
+	{
+		if (&source == this)
+			return ;
+# ifdef FT_DEBUG
+		assert(_alloc == source._alloc);
+# endif
+
+		node *	current = source._nil->left;
+
+		while (current != source._nil)
+		{
+			node *	next = (++iterator(current)).getPtr();
+			node *	parent;
+			bool	left;
+
+			if (this->_locate(current->key(), parent, left) == _nil)
+			{
+				source._unlink(current);
+				this->_link(current, parent, left);
+			}
+			current = next;
+		}
 	}
 
 	///////////////////////
@@ -361,44 +751,52 @@ public:
 	// This effectively reduces the container size by the number of elements removed, which are destroyed.
 	void erase (iterator position)
 	{
-		node * ptr = position.getPtr();
-
-		if (ptr->left != _nil && ptr->right != _nil)
-		{
-			position--;
-			this->_swap_nodes(ptr, position.getPtr());
-			this->erase(ptr);
-		}
-		else
-		{
-			node * child = (ptr->left != _nil) ? ptr->left : ptr->right;
+		node *	ptr = position.getPtr();
 
-			if (child != _nil)
-				child->parent = ptr->parent;
-			if (ptr->parent->left == ptr)
-				ptr->parent->left = child;
-			else
-				ptr->parent->right = child;
-			this->_removeNode(ptr, child);
-		}
+		this->_unlink(ptr);
+		_alloc.destroy(ptr);
+		_alloc.deallocate(ptr, 1);
 	}
 
 	// erase using unique key
 	size_type erase (const key_type & k)
 	{
-		if (this->count(k))
-		{
-			this->erase(this->find(k));
-			return (1);
-		}
-		return (0);
+		node *	found = this->_find_node(k);
+
+		if (found == _nil)
+			return (0);
+		this->erase(iterator(found));
+		return (1);
 	}
 	
 	//  or a range of elements ([first,last)).
 	void erase (iterator first, iterator last)
 	{
-		for (iterator it = first++ ; it != last ; it = first++)
-			this->erase(it);
+		if (first == this->begin() && last == this->end())
+			this->clear();
+		else
+			for (iterator it = first++ ; it != last ; it = first++)
+				this->erase(it);
+	}
+
+	// Takes the element at position out of the container, in a node handle owning it:
+	// the node is neither destroyed nor copied.
+	node_type extract (iterator position)
+	{
+		node *	ptr = position.getPtr();
+
+		this->_unlink(ptr);
+		return (node_type(ptr, _alloc));
+	}
+
+	// Same with the element whose key is k, an empty handle when there is none.
+	node_type extract (const key_type & k)
+	{
+		node *	found = this->_find_node(k);
+
+		if (found == _nil)
+			return (node_type());
+		return (this->extract(iterator(found)));
 	}
 
 	//////////////////////
@@ -412,15 +810,23 @@ public:
 		ft::swap(_alloc, x._alloc);
 		ft::swap(_comp, x._comp);
 		ft::swap(_nil, x._nil);
+		ft::swap(_size, x._size);
 	}
 
 	// Removes all elements from the map container (which are destroyed), 
 	//	leaving the container with a size of 0.
+	// The nodes are freed in one walk, in O(n), with no rebalancing. As in the destructor,
+	//	an ft::node_pool used by this map alone takes them all back at once when destroying
+	//	an element does nothing: the nodes are not visited.
 	void clear (void)
 	{
-		iterator first = this->begin();
-		for (iterator it = first++ ; it != this->end(); it = first++)
-			this->erase(it);
+		if (this->_pool_releases_nodes(ft::can_reserve<allocator_type>()))
+			this->_reset_pool(ft::can_reserve<allocator_type>());
+		else
+			this->_destroy_subtree(_nil->right);
+		_nil->right = _nil;
+		this->_update_ends();
+		_size = 0;
 	}
 	
 	///////////////
@@ -448,38 +854,18 @@ public:
 	//	iterator to it if found, otherwise it returns an iterator to map::end.
 	iterator find (const key_type & k)
 	{
-		if (this->count(k))
-			return (iterator(this->_find_node(_nil->right, k)));
-		else
-			return (this->end());
+		return (iterator(this->_find_node(k)));
 	}
 
 	const_iterator find (const key_type & k) const
 	{
-		if (this->count(k))
-			return (const_iterator(this->_find_node(_nil->right, k)));
-		else
-			return (this->end());
+		return (const_iterator(this->_find_node(k)));
 	}
 
 	// Searchs the container for elements with a key equivalent to k and returns the number of matches.
 	size_type count (const key_type & k) const
 	{
-		node*	currentNode;
-		ft::pair<const Key, T>*		currentPair;	
-		currentNode = this->_nil->right;
-
-		while (currentNode != _nil)
-		{
-			currentPair = &currentNode->data;	
-			if (_comp(k, currentPair->first))
-				currentNode = currentNode->left;
-			else if (_comp(currentPair->first, k))
-				currentNode = currentNode->right;
-			else
-				return (1);
-		}
-		return (0);
+		return (this->_find_node(k) != _nil);
 	}
 
 	//////////////////////
@@ -487,53 +873,122 @@ public:
 	//////////////////////
 
 	// Returns an iterator pointing to the first element in the container whose key is not considered to go
-	// before k (i.e., either it is equivalent or goes after).
+	// before k (i.e., either it is equivalent or goes after). One descent from the root.
 	iterator lower_bound (const key_type & k)
 	{
-		iterator it = this->begin();
-		while (this->_comp(it->first, k) && it != this->end())
-			it++;
-		return (it);
+		return (iterator(this->_lower_bound(k)));
 	}
 
 	const_iterator lower_bound (const key_type & k) const
 	{
-		const_iterator it = this->begin();
-		while (this->_comp(it->first, k) && it != this->end())
-			it++;
-		return (it);
+		return (const_iterator(this->_lower_bound(k)));
 	}
 
 	//	Returns an iterator pointing to the first element in the container 
-	//	whose key is considered to go after k.
+	//	whose key is considered to go after k. One descent from the root.
 	iterator upper_bound (const key_type & k)
 	{
-		iterator it = this->begin();
-		while (this->_comp(k, it->first) == false && it != this->end())
-			it++;
-		return (it);
+		return (iterator(this->_upper_bound(k)));
 	}
 
 	const_iterator upper_bound (const key_type & k) const
 	{
-		const_iterator it = this->begin();
-		while (this->_comp(k, it->first) == false && it != this->end())
-			it++;
-		return (it);
+		return (const_iterator(this->_upper_bound(k)));
 	}
 
 	// Returns the bounds of a range that includes all the elements in the container which 
-	// have a key equivalent to k.
+	// have a key equivalent to k. Both bounds come from the same descent.
 	ft::pair<iterator,iterator> equal_range (const key_type & k)
 	{
-		return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		ft::pair<node *, node *>	range = this->_equal_range(k);
+
+		return (ft::make_pair(iterator(range.first), iterator(range.second)));
 	}
 
 	ft::pair<const_iterator,const_iterator> equal_range (const key_type & k) const
 	{
-		return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+		ft::pair<node *, node *>	range = this->_equal_range(k);
+
+		return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+	}
+
+# ifdef FT_MAP_ORDER_STATISTICS
+	//////////////////////
+	// Order statistics //
+	//////////////////////
+
+	// Returns an iterator to the element at position k in key order, end() when k >= size().
+	iterator select (size_type k)
+	{
+		return (iterator(this->_select(k)));
+	}
+
+	const_iterator select (size_type k) const
+	{
+		return (const_iterator(this->_select(k)));
+	}
+
+	// Returns the number of elements whose key goes before k (the position lower_bound(k) would have).
+	size_type rank (const key_type & k) const
+	{
+		size_type	r = 0;
+		node *		current = _nil->right;
+
+		while (current != _nil)
+		{
+			if (_comp(current->key(), k))
+			{
+				r += current->left->count + 1;
+				current = current->right;
+			}
+			else
+				current = current->left;
+		}
+		return (r);
 	}
 
+	// Returns the number of elements whose key is in [lo, hi).
+	size_type count_range (const key_type & lo, const key_type & hi) const
+	{
+		if (!_comp(lo, hi))
+			return (0);
+		return (this->rank(hi) - this->rank(lo));
+	}
+
+	// Returns the position of it in key order, size() for end().
+	size_type index_of (const_iterator it) const
+	{
+		const node *	current = it.getPtr();
+
+		if (current == _nil)
+			return (_size);
+
+		size_type		r = current->left->count;
+
+		for ( ; current->parent != _nil ; current = current->parent)
+			if (current == current->parent->right)
+				r += current->parent->left->count + 1;
+		return (r);
+	}
+
+	// Number of increments from first to last, first must not go after last.
+	difference_type distance (const_iterator first, const_iterator last) const
+	{
+		return (this->index_of(last) - this->index_of(first));
+	}
+
+	// Moves it by n positions, the result must lie in [begin(), end()].
+	void advance (iterator & it, difference_type n) const
+	{
+		it = iterator(this->_select(this->index_of(it) + n));
+	}
+
+	void advance (const_iterator & it, difference_type n) const
+	{
+		it = const_iterator(this->_select(this->index_of(it) + n));
+	}
+
+# endif
 	///////////////
 	// Allocator //
 	///////////////
@@ -541,7 +996,7 @@ public:
 	// Returns a copy of the allocator object associated with the map.
 	allocator_type get_allocator (void) const
 	{
-		return (allocator_type());
+		return (_alloc);
 	}
 
 	///////////////////////
@@ -553,38 +1008,102 @@ private:
 	{
 		_nil = _alloc.allocate(1);
 		this->_construct(_nil);
-		_nil->color = BLACK_;
+		_nil->set_color(BLACK_);
+		_nil->set_sentinel();
+# ifdef FT_MAP_ORDER_STATISTICS
+		_nil->count = 0;
+# endif
 	}
 
-	// create new node
-	node * _new_node (const value_type & val = value_type())
+	void _delete_nil_node (void)
+	{
+		_alloc.destroy(_nil);
+		_alloc.deallocate(_nil, 1);
+	}
+
+	// allocate and construct a node which is not linked to the tree yet.
+	node * _make_node (const value_type & val)
 	{
-	
 		node * new_node = _alloc.allocate(1);
 		this->_construct(new_node, val);
-		node * parent = this->_find_parent(_nil->right, val.first);
-		if (parent == _nil || !this->_comp(val.first, parent->key()))
+		return (new_node);
+	}
+
+	// create new node and hang it on the left or right of parent, as found by _locate.
+	node * _new_node (const value_type & val, node * parent, bool left)
+	{
+		node * new_node = this->_make_node(val);
+		this->_link(new_node, parent, left);
+		return (new_node);
+	}
+
+	// links the node of a handle where _locate or _hint_parent said, the handle is left empty.
+	node * _adopt (const node_type & nh, node * parent, bool left)
+	{
+		node *	ptr = nh._ptr;
+
+# ifdef FT_DEBUG
+		assert(_alloc == nh._alloc);
+# endif
+		nh._ptr = NULL;
+		this->_link(ptr, parent, left);
+		return (ptr);
+	}
+
+	// hangs a node which is in no tree on the left or right of parent and rebalances.
+	// The node may come from another map: all its links are reset.
+	void _link (node * ptr, node * parent, bool left)
+	{
+		ptr->left = _nil;
+		ptr->right = _nil;
+		ptr->set_color(RED_);
+# ifdef FT_MAP_ORDER_STATISTICS
+		ptr->count = 1;
+# endif
+		if (left)
+			parent->left = ptr;
+		else
+			parent->right = ptr;
+		ptr->parent = parent;
+		if (parent == _nil || (left && parent == _nil->left))
+			_nil->left = ptr;
+		if (parent == _nil || (!left && parent == _nil->parent))
+			_nil->parent = ptr;
+		this->_add_count(parent, 1);
+		this->_insertRB(ptr);
+		_size++;
+	}
+
+	// construct a new node in the memory at ptr, which goes back to the allocator
+	// when copying the element throws.
+	void _construct (node * ptr, const value_type & val = value_type())
+	{
+		try
 		{
-			parent->right = new_node;
+			node tmp(val);
+			tmp.left = _nil;
+			tmp.right = _nil;
+			tmp.parent = _nil;
+			tmp.set_color(RED_);
+# ifdef FT_MAP_ORDER_STATISTICS
+			tmp.count = 1;
+# endif
+			_alloc.construct(ptr, tmp);
 		}
-		else
+		catch (...)
 		{
-			parent->left = new_node;						
+			_alloc.deallocate(ptr, 1);
+			throw;
 		}
-		new_node->parent = parent;
-		this->_insertRB(new_node);
-		return (new_node);
 	}
 
-	// construct a new node 
-	void _construct (node * ptr, const value_type & val = value_type())
+	// exchanges the colors of two nodes, the nodes keep their places.
+	void _swap_colors (node * a, node * b)
 	{
-		node tmp(val);
-		tmp.left = _nil;
-		tmp.right = _nil;
-		tmp.parent = _nil;
-		tmp.color = RED_;
-		_alloc.construct(ptr, tmp);
+		bool	color = a->color();
+
+		a->set_color(b->color());
+		b->set_color(color);
 	}
 
 	// swap two nodes
@@ -630,7 +1149,10 @@ private:
 		ft::swap(a->parent, b->parent);
 		ft::swap(a->left, b->left);
 		ft::swap(a->right, b->right);
-		ft::swap(a->color, b->color);
+		this->_swap_colors(a, b);
+# ifdef FT_MAP_ORDER_STATISTICS
+		ft::swap(a->count, b->count); // the sizes belong to the positions, not to the elements
+# endif
 
 		if (_nil->right == a)
 			_nil->right = b;
@@ -638,58 +1160,440 @@ private:
 			_nil->right = a;
 	}
 
-	// remove node, destroy, and deallocate.
-	void _removeNode (node * ptr, node * child)
+	// takes a node out of the tree and rebalances, without destroying it. A node with
+	// two children first trades places with its predecessor, which has no right child.
+	void _unlink (node * ptr)
 	{
+		if (ptr->left != _nil && ptr->right != _nil)
+			this->_swap_nodes(ptr, (--iterator(ptr)).getPtr());
+
+		node * child = (ptr->left != _nil) ? ptr->left : ptr->right;
+
+		if (ptr == _nil->left)
+			_nil->left = (++iterator(ptr)).getPtr();
+		if (ptr == _nil->parent)
+			_nil->parent = (--iterator(ptr)).getPtr();
+		if (child != _nil)
+			child->parent = ptr->parent;
+		// right first: the root hangs on the right of _nil, whose left is the leftmost node.
+		if (ptr->parent->right == ptr)
+			ptr->parent->right = child;
+		else
+			ptr->parent->left = child;
+		this->_add_count(ptr->parent, -1);
 		this->_deleteRB(ptr, child);
-		_alloc.destroy(ptr);
-		_alloc.deallocate(ptr, 1);
+		_size--;
 	}
 
-	// search a certain node corresponding to a given key.
-	node * _find_node (node * current, const key_type & k) const
+	// unhooks every node from the tree in O(n) without rebalancing: the tree is walked
+	// down, cutting each link it follows, and a node is pushed on the returned list
+	// (chained by right) once it has no child left. The container is left empty.
+	node * _detach_nodes (void)
 	{
-		if (current == _nil || this->_equal(current->key(), k))
-			return (current);
-		else if (this->_comp(k, current->key()))
-			return (this->_find_node(current->left, k));
-		else
-			return (this->_find_node(current->right, k));
+		node *	list = _nil;
+		node *	current = _nil->right;
+
+		while (current != _nil)
+		{
+			node *	next;
+
+			if (current->left != _nil)
+			{
+				next = current->left;
+				current->left = _nil;
+			}
+			else if (current->right != _nil)
+			{
+				next = current->right;
+				current->right = _nil;
+			}
+			else
+			{
+				next = current->parent;
+				current->right = list;
+				list = current;
+			}
+			current = next;
+		}
+		_nil->right = _nil;
+		this->_update_ends();
+		_size = 0;
+		return (list);
 	}
 
-	// _find a given node's parent according to a key.
-	node * _find_parent (node * current, const key_type & k) const
+	// unhooks every node from the tree into a list chained by right in key order, in O(n):
+	// the tree is walked from the rightmost node backwards and each node is pushed in
+	// front of the list. Finding a predecessor only reads left and parent links, and
+	// the right links of the nodes before it, which are still intact. The container is left empty.
+	node * _unlink_in_order (void)
 	{
-		if (!this->_comp(k, current->key()))
+		node *	list = _nil;
+		node *	current = _nil->parent;
+
+		while (current != _nil)
 		{
-			if (current->right == _nil)
-				return (current);
+			node *	prev;
+
+			if (current->left != _nil)
+				prev = this->_rightmost(current->left);
 			else
-				return (this->_find_parent(current->right, k));
+			{
+				prev = current;
+				while (prev->parent != _nil && prev == prev->parent->left)
+					prev = prev->parent;
+				prev = prev->parent;
+			}
+			current->right = list;
+			list = current;
+			current = prev;
 		}
+		_nil->right = _nil;
+		this->_update_ends();
+		_size = 0;
+		return (list);
+	}
+
+	// adds a node at the end of a list chained by right.
+	void _append (node *& head, node *& tail, node * current)
+	{
+		if (tail == _nil)
+			head = current;
 		else
+			tail->right = current;
+		tail = current;
+	}
+
+	// makes the tree of an empty container out of the n nodes of list, chained by right
+	// in key order. Every subtree splits its nodes evenly, so all the leaves are on the
+	// last two levels: those are black and the nodes of the last level are red, which
+	// gives the same black height to every path.
+	void _build (node * list, size_type n)
+	{
+		size_type	red_depth = 0;
+
+		for (size_type k = n ; k > 1 ; k /= 2)
+			red_depth++;
+		_nil->right = this->_build_subtree(list, n, 0, red_depth);
+		_nil->right->parent = _nil;
+		_nil->right->set_color(BLACK_);
+		this->_update_ends();
+		_size = n;
+	}
+
+	// takes the next n nodes of list and returns them as a balanced subtree:
+	// the left half is built first, then the middle node, then the right half.
+	node * _build_subtree (node *& list, size_type n, size_type depth, size_type red_depth)
+	{
+		if (n == 0)
+			return (_nil);
+
+		node *	left = this->_build_subtree(list, (n - 1) / 2, depth + 1, red_depth);
+		node *	current = list;
+
+		list = list->right;
+		current->left = left;
+		if (left != _nil)
+			left->parent = current;
+		current->right = this->_build_subtree(list, n - 1 - (n - 1) / 2, depth + 1, red_depth);
+		if (current->right != _nil)
+			current->right->parent = current;
+		current->set_color((depth == red_depth) ? RED_ : BLACK_);
+# ifdef FT_MAP_ORDER_STATISTICS
+		current->count = n;
+# endif
+		return (current);
+	}
+
+	void _reserve (size_type n, true_type)
+	{
+		if (n > _size)
+			_alloc.reserve(n - _size);
+	}
+
+	void _reserve (size_type, false_type) {}
+
+	// whether the nodes can be left to the allocator on destruction: the pool goes
+	// away with this map and destroying an element does nothing.
+	bool _pool_releases_nodes (true_type) const
+	{
+		return (_alloc.unique() && ft::is_trivially_destructible<value_type>::value);
+	}
+
+	bool _pool_releases_nodes (false_type) const
+	{
+		return (false);
+	}
+
+	// every node but _nil goes back to the pool, end() stays valid.
+	void _reset_pool (true_type)
+	{
+		_alloc.reset(_nil);
+	}
+
+	void _reset_pool (false_type) {}
+
+	// destroys and deallocates current and its subtrees, in key order: only the
+	// left subtrees recurse, so the depth stays within the height of the tree.
+	void _destroy_subtree (node * current)
+	{
+		while (current != _nil)
 		{
-			if (current->left == _nil)
+			node *	right = current->right;
+
+			this->_destroy_subtree(current->left);
+			_alloc.destroy(current);
+			_alloc.deallocate(current, 1);
+			current = right;
+		}
+	}
+
+	// destroys and deallocates a list of nodes made by _detach_nodes.
+	void _free_nodes (node * list)
+	{
+		while (list != _nil)
+		{
+			node *	next = list->right;
+
+			_alloc.destroy(list);
+			_alloc.deallocate(list, 1);
+			list = next;
+		}
+	}
+
+	// copies src (a node of another tree whose sentinel is src_nil) and its subtrees under parent,
+	// in slot. Nodes come from the spare list first, and are only allocated once it is empty.
+	// A node is in slot only once its element is built, so a partial clone can be destroyed.
+	void _clone (const node * src, const node * src_nil, node * parent, node *& slot, node *& spare)
+	{
+		node *	copy;
+
+		if (spare != _nil)
+		{
+			copy = spare;
+			spare = spare->right;
+			_alloc.destroy(copy);
+		}
+		else
+			copy = _alloc.allocate(1);
+		this->_construct(copy, src->data);
+		copy->parent = parent;
+		copy->set_color(src->color());
+# ifdef FT_MAP_ORDER_STATISTICS
+		copy->count = src->count;
+# endif
+		slot = copy;
+		if (src->left != src_nil)
+			this->_clone(src->left, src_nil, copy, copy->left, spare);
+		if (src->right != src_nil)
+			this->_clone(src->right, src_nil, copy, copy->right, spare);
+	}
+
+	// the single descent behind find, insert and operator[]: returns the node holding k,
+	// or _nil with parent / left set to where a node for k has to be hung
+	// (parent is _nil and left false when the tree is empty).
+	node * _locate (const key_type & k, node *& parent, bool & left) const
+	{
+		node *	current = _nil->right;
+
+		parent = _nil;
+		left = false;
+		while (current != _nil)
+		{
+			parent = current;
+			if (_comp(k, current->key()))
+			{
+				left = true;
+				current = current->left;
+			}
+			else if (_comp(current->key(), k))
+			{
+				left = false;
+				current = current->right;
+			}
+			else
 				return (current);
+		}
+		return (_nil);
+	}
+
+	// search a certain node corresponding to a given key, _nil when there is none.
+	node * _find_node (const key_type & k) const
+	{
+		node *	parent;
+		bool	left;
+
+		return (this->_locate(k, parent, left));
+	}
+
+	// where a node for k can hang right next to hint without a descent: at the end,
+	// between hint and its predecessor or between hint and its successor.
+	// Returns false when k does not fit there (or is already there).
+	bool _hint_parent (node * hint, const key_type & k, node *& parent, bool & left) const
+	{
+		if (hint == _nil)
+		{
+			if (_nil->right == _nil)
+				return (false);
+			parent = _nil->parent;
+			left = false;
+			return (_comp(parent->key(), k));
+		}
+		if (_comp(k, hint->key()))
+		{
+			iterator	prev(hint);
+			node *		before = (--prev).getPtr();
+
+			if (before != _nil && !_comp(before->key(), k))
+				return (false);
+			left = (hint->left == _nil);
+			parent = left ? hint : before;
+			return (true);
+		}
+		if (_comp(hint->key(), k))
+		{
+			iterator	next(hint);
+			node *		after = (++next).getPtr();
+
+			if (after != _nil && !_comp(k, after->key()))
+				return (false);
+			left = (hint->right != _nil);
+			parent = left ? after : hint;
+			return (true);
+		}
+		return (false);
+	}
+
+	// first node whose key does not go before k, _nil when there is none.
+	node * _lower_bound (const key_type & k) const
+	{
+		node *	current = _nil->right;
+		node *	bound = _nil;
+
+		while (current != _nil)
+		{
+			if (_comp(current->key(), k))
+				current = current->right;
 			else
-				return (this->_find_parent(current->left, k));
+			{
+				bound = current;
+				current = current->left;
+			}
 		}
+		return (bound);
+	}
+
+	// first node whose key goes after k, _nil when there is none.
+	node * _upper_bound (const key_type & k) const
+	{
+		node *	current = _nil->right;
+		node *	bound = _nil;
+
+		while (current != _nil)
+		{
+			if (_comp(k, current->key()))
+			{
+				bound = current;
+				current = current->left;
+			}
+			else
+				current = current->right;
+		}
+		return (bound);
+	}
+
+	// lower and upper bound of k in one descent: keys are unique, so once the node
+	// holding k is met the upper bound is its successor, either the leftmost node
+	// of its right subtree or the last node the descent went left from.
+	ft::pair<node *, node *> _equal_range (const key_type & k) const
+	{
+		node *	current = _nil->right;
+		node *	bound = _nil;
+
+		while (current != _nil)
+		{
+			if (_comp(k, current->key()))
+			{
+				bound = current;
+				current = current->left;
+			}
+			else if (_comp(current->key(), k))
+				current = current->right;
+			else if (current->right != _nil)
+				return (ft::make_pair(current, this->_leftmost(current->right)));
+			else
+				return (ft::make_pair(current, bound));
+		}
+		return (ft::make_pair(bound, bound));
+	}
+
+	// points the header at the first and last nodes (_nil->left and _nil->parent)
+	// once the tree was rebuilt or emptied, insertions and erasures update them in place.
+	void _update_ends (void)
+	{
+		_nil->left = (_nil->right == _nil) ? _nil : this->_leftmost(_nil->right);
+		_nil->parent = this->_rightmost(_nil->right);
 	}
 
 	// find leftmost ( lowest node) in the RB tree.
 	node * _leftmost (node * root) const
 	{
-		while (root->left != root->left->left)
+		while (root->left != _nil)
 			root = root->left;
 		return (root);
 	}
 
-	// check if 
-	bool _equal (const key_type & lhs, const key_type & rhs) const
+	// find rightmost ( highest node) in the RB tree.
+	node * _rightmost (node * root) const
+	{
+		while (root->right != _nil)
+			root = root->right;
+		return (root);
+	}
+
+	// adds delta to the subtree sizes from current up to the root.
+	void _add_count (node * current, difference_type delta)
 	{
-		return (this->_comp(lhs, rhs) == false && this->_comp(rhs, lhs) == false);
+# ifdef FT_MAP_ORDER_STATISTICS
+		for ( ; current != _nil ; current = current->parent)
+			current->count += delta;
+# else
+		(void)current;
+		(void)delta;
+# endif
 	}
 
+	// recomputes the subtree size of a node from its children, after a rotation.
+	void _update_count (node * current)
+	{
+# ifdef FT_MAP_ORDER_STATISTICS
+		current->count = current->left->count + current->right->count + 1;
+# else
+		(void)current;
+# endif
+	}
+
+# ifdef FT_MAP_ORDER_STATISTICS
+	// the node at position k in key order, _nil when k >= size().
+	node * _select (size_type k) const
+	{
+		node *	current = _nil->right;
+
+		if (k >= _size)
+			return (_nil);
+		while (k != current->left->count)
+		{
+			if (k < current->left->count)
+				current = current->left;
+			else
+			{
+				k -= current->left->count + 1;
+				current = current->right;
+			}
+		}
+		return (current);
+	}
+# endif
+
 	////////////////////////
 	// Red and Black Tree //
 	////////////////////////
@@ -703,21 +1607,21 @@ private:
 
 		if (parent == _nil)
 		{
-			x->color = BLACK_;						
+			x->set_color(BLACK_);						
 		}
-		else if (parent->color == BLACK_)
+		else if (parent->color() == BLACK_)
 		{
 			return ;
 		}
 
-		else if (uncle->color == RED_)
+		else if (uncle->color() == RED_)
 		{
-			parent->color = BLACK_;
-			uncle->color = BLACK_;
-			grandparent->color = RED_;
+			parent->set_color(BLACK_);
+			uncle->set_color(BLACK_);
+			grandparent->set_color(RED_);
 			this->_insertRB(grandparent);
 		}
-		else if (uncle->color == BLACK_)
+		else if (uncle->color() == BLACK_)
 		{
 			if (grandparent->left->left == x || grandparent->right->right == x)
 			{
@@ -725,7 +1629,7 @@ private:
 					this->_LL(grandparent, parent);
 				else if (grandparent->right->right == x)
 					this->_RR(grandparent, parent);
-				ft::swap(grandparent->color, parent->color);
+				this->_swap_colors(grandparent, parent);
 			}
 			else
 			{
@@ -733,61 +1637,89 @@ private:
 					this->_LR(grandparent, parent, x);
 				else if (grandparent->right->left == x)
 					this->_RL(grandparent, parent, x);
-				ft::swap(grandparent->color, x->color);
+				this->_swap_colors(grandparent, x);
 			}
 		}
 	}
 
-	// 
+	// v was removed and u (maybe _nil) took its place: removing a red node, or a black
+	// one replaced by a red child, keeps every black height, otherwise u is one black short.
 	void _deleteRB (node * v, node * u)
-	{	
-		if (v->color == RED_ || u->color == RED_)
-			u->color = BLACK_;
+	{
+		if (v->color() == RED_)
+			return ;
+		if (u->color() == RED_)
+			u->set_color(BLACK_);
 		else
 			this->_doubleBlack(u, v->parent);
 	}
 
-	// 
+	// u, child of parent, has one black less than its sibling: recolor and rotate
+	// until the missing black is absorbed by a red node or reaches the root.
+	// u may be _nil, which is why its parent is passed along.
 	void _doubleBlack (node * u, node * parent)
-	{	
-		node * sibling = (parent->left != u) ? parent->left : parent->right;
-
-		if (u == _nil->right || _nil == _nil->right || parent != _nil->left)
-			return ;
-		else if (sibling->color == BLACK_ && (sibling->left->color == RED_ || sibling->right->color == RED_))
+	{
+		while (u != _nil->right && u->color() == BLACK_)
 		{
-			if (sibling == parent->left && sibling->left->color == RED_ )
-				this->_LL(parent, sibling);
-			else if (sibling == parent->left && sibling->right->color == RED_)
-				this->_LR(parent, sibling, sibling->right);
-			else if (sibling == parent->right && sibling->right->color == RED_)
+			if (u == parent->left)
+			{
+				node * sibling = parent->right;
+
+				if (sibling->color() == RED_)
+				{
+					this->_swap_colors(parent, sibling);
+					this->_RR(parent, sibling);
+					sibling = parent->right;
+				}
+				if (sibling->left->color() == BLACK_ && sibling->right->color() == BLACK_)
+				{
+					sibling->set_color(RED_);
+					u = parent;
+					parent = u->parent;
+					continue ;
+				}
+				if (sibling->right->color() == BLACK_)
+				{
+					this->_swap_colors(sibling, sibling->left);
+					this->_LL(sibling, sibling->left);
+					sibling = parent->right;
+				}
+				sibling->set_color(parent->color());
+				parent->set_color(BLACK_);
+				sibling->right->set_color(BLACK_);
 				this->_RR(parent, sibling);
-			else if (sibling == parent->right && sibling->left->color == RED_)
-				this->_RL(parent, sibling, sibling->left);
-			if (sibling->left->color == RED_)
-				sibling->left->color = BLACK_;
-			else
-				sibling->right->color = BLACK_;
-		}
-		else if (sibling->color == BLACK_)
-		{
-			sibling->color = RED_;
-			if (parent->color == RED_)
-				parent->color = BLACK_;
-			else if(_nil != _nil->right)
-				this->_doubleBlack(parent, parent->parent);
+			}
 			else
-				return;
-		}
-		else if (sibling->color == RED_)
-		{
-			if (sibling == parent->left)
+			{
+				node * sibling = parent->left;
+
+				if (sibling->color() == RED_)
+				{
+					this->_swap_colors(parent, sibling);
+					this->_LL(parent, sibling);
+					sibling = parent->left;
+				}
+				if (sibling->left->color() == BLACK_ && sibling->right->color() == BLACK_)
+				{
+					sibling->set_color(RED_);
+					u = parent;
+					parent = u->parent;
+					continue ;
+				}
+				if (sibling->left->color() == BLACK_)
+				{
+					this->_swap_colors(sibling, sibling->right);
+					this->_RR(sibling, sibling->right);
+					sibling = parent->left;
+				}
+				sibling->set_color(parent->color());
+				parent->set_color(BLACK_);
+				sibling->left->set_color(BLACK_);
 				this->_LL(parent, sibling);
-			else
-				this->_RR(parent, sibling);
-			ft::swap(parent->color, sibling->color);
-				this->_doubleBlack(u, parent);
+			}
+			u = _nil->right;
 		}
+		u->set_color(BLACK_);
 	}
 
 	// tree manipulation fonctions to balance 
@@ -804,6 +1736,8 @@ private:
 		parent->parent = grandparent->parent;
 		grandparent->parent = parent;
 		parent->right = grandparent;
+		this->_update_count(grandparent);
+		this->_update_count(parent);
 	}
 
 	void _RR (node * grandparent, node * parent)
@@ -819,6 +1753,8 @@ private:
 		parent->parent = grandparent->parent;
 		grandparent->parent = parent;
 		parent->left = grandparent;
+		this->_update_count(grandparent);
+		this->_update_count(parent);
 	}
 
 	void _LR (node * grandparent, node * parent, node * x)
@@ -838,6 +1774,9 @@ private:
 		parent->parent = x;
 		x->left = parent;
 		x->right = grandparent;
+		this->_update_count(parent);
+		this->_update_count(grandparent);
+		this->_update_count(x);
 	}
 
 	void _RL (node * grandparent, node * parent, node * x)
@@ -857,6 +1796,9 @@ private:
 		parent->parent = x;
 		x->left = grandparent;
 		x->right = parent;
+		this->_update_count(grandparent);
+		this->_update_count(parent);
+		this->_update_count(x);
 	}
 
 	//////////////////////
@@ -866,6 +1808,7 @@ private:
 	allocator_type		_alloc;
 	key_compare			_comp;
 	node *				_nil;
+	size_type			_size;
 }; // Map
 
 	//////////////////////////
@@ -875,7 +1818,7 @@ private:
 	template <class Key, class T, class Compare, class Alloc>
 	bool operator== (const map<Key,T,Compare,Alloc> & lhs, const map<Key,T,Compare,Alloc> & rhs)
 	{
-		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 	}
 
 	template <class Key, class T, class Compare, class Alloc>
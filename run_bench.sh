@@ -0,0 +1,37 @@
+#!/bin/bash
+echo "-----------  Growth policies  ----------- "
+g++ -std=c++98 -O2 ./tests/bench_growth.cpp
+./a.out
+rm -rf a.out
+echo "-----------  vector<char> past 2^31  ----------- "
+g++ -std=c++98 -O2 ./tests/bench_big_vector.cpp
+./a.out
+rm -rf a.out
+echo "-----------  flat_map vs map  ----------- "
+g++ -std=c++98 -O2 ./tests/bench_flat_map.cpp
+./a.out
+rm -rf a.out
+echo "-----------  map loads vs std::map  ----------- "
+g++ -std=c++98 -O2 ./tests/bench_map_insert.cpp
+./a.out
+rm -rf a.out
+echo "-----------  map with node_pool  ----------- "
+g++ -std=c++98 -O2 ./tests/bench_map_pool.cpp
+./a.out
+rm -rf a.out
+echo "-----------  map<int, int> bytes per element  ----------- "
+g++ -std=c++98 -O2 ./tests/bench_map_memory.cpp
+./a.out
+rm -rf a.out
+g++ -std=c++98 -O2 -DFT_MAP_COMPACT_NODES ./tests/bench_map_memory.cpp
+./a.out
+rm -rf a.out
+echo "-----------  map iteration  ----------- "
+g++ -std=c++98 -O2 ./tests/bench_map_iterate.cpp
+./a.out
+rm -rf a.out
+echo "-----------  map node handles  ----------- "
+g++ -std=c++98 -O2 ./tests/bench_map_extract.cpp
+./a.out
+rm -rf a.out
+echo "-----------       END      ----------- "
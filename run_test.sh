@@ -18,6 +18,33 @@ echo "-----------     FT TEST    ----------- "
 g++ -std=c++98 ./tests/ft_vector.cpp
 time ./a.out 123
 rm -rf a.out
+echo "-----------  Vector tests (C++11 moves)  ----------- "
+echo "-----------    STD TEST    ----------- "
+g++ -std=c++11 ./tests/std_vector.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------     FT TEST    ----------- "
+g++ -std=c++11 ./tests/ft_vector.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------  Small vector tests  ----------- "
+echo "-----------    STD TEST    ----------- "
+g++ -std=c++98 ./tests/std_small_vector.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------     FT TEST    ----------- "
+g++ -std=c++98 ./tests/ft_small_vector.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------   Span tests   ----------- "
+echo "-----------    STD TEST    ----------- "
+g++ -std=c++98 ./tests/std_span.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------     FT TEST    ----------- "
+g++ -std=c++98 ./tests/ft_span.cpp
+time ./a.out 123
+rm -rf a.out
 echo "-----------  Stack tests  ----------- "
 echo "-----------    STD TEST   ----------- "
 g++ -std=c++98 ./tests/std_stack.cpp
@@ -36,4 +63,40 @@ echo "-----------     FT TEST    ----------- "
 g++ -std=c++98 ./tests/ft_map.cpp
 time ./a.out 123
 rm -rf a.out
+echo "-----------  Map tests (order statistics)  ----------- "
+echo "-----------    STD TEST    ----------- "
+g++ -std=c++98 ./tests/std_map.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------     FT TEST    ----------- "
+g++ -std=c++98 -DFT_MAP_ORDER_STATISTICS ./tests/ft_map.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------  Map tests (compact nodes)  ----------- "
+echo "-----------    STD TEST    ----------- "
+g++ -std=c++98 ./tests/std_map.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------     FT TEST    ----------- "
+g++ -std=c++98 -DFT_MAP_COMPACT_NODES ./tests/ft_map.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------   Deque tests   ----------- "
+echo "-----------    STD TEST    ----------- "
+g++ -std=c++98 ./tests/std_deque.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------     FT TEST    ----------- "
+g++ -std=c++98 ./tests/ft_deque.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------  Flat map tests  ----------- "
+echo "-----------    STD TEST    ----------- "
+g++ -std=c++98 ./tests/std_flat_map.cpp
+time ./a.out 123
+rm -rf a.out
+echo "-----------     FT TEST    ----------- "
+g++ -std=c++98 ./tests/ft_flat_map.cpp
+time ./a.out 123
+rm -rf a.out
 echo "-----------       END      ----------- "
\ No newline at end of file
@@ -0,0 +1,399 @@
+#ifndef SMALL_VECTOR_HPP
+# define SMALL_VECTOR_HPP
+
+# include "vector.hpp"
+
+// vector with inline storage
+//	A small_vector holds up to N elements inside the object itself and only spills
+//	to the heap when it grows past N, short-lived small vectors never allocate.
+//	It is built on an ft::vector (same iterators, same member functions) whose allocator
+//	hands out the inline buffer and whose growth policy never goes below N. That vector
+//	is a private base: its allocator points into this object, so it must never be
+//	copied, swapped or assigned on its own, the members it shares are re-exported.
+
+namespace ft
+{
+
+	//////////////////////
+	// Inline allocator //
+	//////////////////////
+
+	// Allocator giving out a buffer of n elements owned by someone else, any other
+	// request (or a request while the buffer is taken) goes to the upstream allocator Alloc.
+	template <class T, class Alloc = std::allocator<T> >
+	class inline_allocator : public Alloc {
+	public:
+		typedef typename Alloc::size_type		size_type;
+		typedef typename Alloc::pointer			pointer;
+
+		template <class U>
+		struct rebind { typedef inline_allocator<U, typename Alloc::template rebind<U>::other> other; };
+
+		inline_allocator	(void)										: Alloc(), _buf(NULL), _n(0), _used(false) {}
+		inline_allocator	(pointer buf, size_type n, const Alloc & alloc = Alloc())
+																		: Alloc(alloc), _buf(buf), _n(n), _used(false) {}
+		inline_allocator	(const inline_allocator & x)				: Alloc(x), _buf(x._buf), _n(x._n), _used(x._used) {}
+		~inline_allocator	(void)										{}
+
+		inline_allocator &	operator= (const inline_allocator & x)
+		{
+			Alloc::operator=(x);
+			_buf = x._buf;
+			_n = x._n;
+			_used = x._used;
+			return (*this);
+		}
+
+		pointer allocate (size_type n, const void * = 0)
+		{
+			if (_buf && n <= _n && !_used)
+			{
+				_used = true;
+				return (_buf);
+			}
+			return (Alloc::allocate(n));
+		}
+
+		void deallocate (pointer p, size_type n)
+		{
+			if (p && p == _buf)
+				_used = false;
+			else
+				Alloc::deallocate(p, n);
+		}
+
+		// whether p is the inline buffer.
+		bool is_inline (const T * p) const
+		{
+			return (p && p == _buf);
+		}
+
+		// gives the inline buffer back without going through deallocate.
+		void release_inline (void)
+		{
+			_used = false;
+		}
+
+	private:
+		pointer		_buf;
+		size_type	_n;
+		bool		_used;
+	};
+
+	///////////////////
+	// Inline growth //
+	///////////////////
+
+	// Growth policy adapter keeping the capacity at N or above: the first growth goes
+	// straight to the inline buffer and shrinking below N comes back to it.
+	template <class Growth, std::size_t N>
+	struct inline_growth : public Growth
+	{
+		template <class Alloc>
+		static std::size_t grow (std::size_t current, std::size_t needed)
+		{
+			std::size_t		cap = Growth::template grow<Alloc>(current, needed);
+
+			return ((cap < N) ? N : cap);
+		}
+
+		template <class Alloc>
+		static std::size_t release (std::size_t size, std::size_t capacity)
+		{
+			std::size_t		cap = Growth::template release<Alloc>(size, capacity);
+
+			if (cap >= N)
+				return (cap);
+			return ((capacity < N) ? capacity : N);
+		}
+	};
+
+	////////////////////
+	// Inline storage //
+	////////////////////
+
+	// raw, suitably aligned, memory for N elements. It is a base class of small_vector
+	// so that it exists before the vector part is constructed.
+	template <class T, std::size_t N>
+	struct inline_storage
+	{
+# ifdef FT_CXX11_
+		alignas(T) unsigned char	_inline[N * sizeof(T)];
+# else
+		unsigned char				_inline[N * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+# endif
+		T *	_inline_ptr (void)	{ return (reinterpret_cast<T *>(_inline)); }
+	};
+
+	//////////////////
+	// Small vector //
+	//////////////////
+
+template <class T, std::size_t N, class Alloc = std::allocator<T>, class Growth = ft::growth_double>
+class small_vector : private inline_storage<T, N>,
+	private vector<T, inline_allocator<T, Alloc>, inline_growth<Growth, N> > {
+	typedef		vector<T, inline_allocator<T, Alloc>, inline_growth<Growth, N> >	vector_type;
+	typedef		typename vector_type::allocator_type								inline_alloc_type;
+
+public:
+
+	//////////////////
+	// Member types //
+	//////////////////
+
+	typedef		typename vector_type::value_type									value_type;
+	typedef		Alloc																allocator_type;
+	typedef		typename vector_type::reference										reference;
+	typedef		typename vector_type::const_reference								const_reference;
+	typedef		typename vector_type::pointer										pointer;
+	typedef		typename vector_type::const_pointer									const_pointer;
+	typedef		typename vector_type::iterator										iterator;
+	typedef		typename vector_type::const_iterator								const_iterator;
+	typedef		typename vector_type::reverse_iterator								reverse_iterator;
+	typedef		typename vector_type::const_reverse_iterator						const_reverse_iterator;
+	typedef		typename vector_type::difference_type								difference_type;
+	typedef		typename vector_type::size_type										size_type;
+
+	static const size_type	inline_capacity = N;	// number of elements held without allocating
+
+	//////////////////
+	// Constructors //
+	//////////////////
+
+	//default constructor : Constructs an empty container using the inline storage.
+	explicit small_vector (const Alloc & alloc = Alloc())
+		: inline_storage<T, N>(), vector_type(inline_alloc_type(this->_inline_ptr(), N, alloc))
+	{
+		this->reserve(N);
+	}
+
+	//fill constructor: Constructs a container with n elements. Each element is a copy of val.
+	explicit small_vector (size_type n, const value_type & val = value_type(), const Alloc & alloc = Alloc())
+		: inline_storage<T, N>(), vector_type(inline_alloc_type(this->_inline_ptr(), N, alloc))
+	{
+		this->reserve((n > N) ? n : N);
+		this->assign(n, val);
+	}
+
+	//range constructor: Constructs a container with as many elements as the range [first,last).
+	template <class InputIterator>
+	small_vector (InputIterator first, InputIterator last, const Alloc & alloc = Alloc(),
+	typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
+		: inline_storage<T, N>(), vector_type(inline_alloc_type(this->_inline_ptr(), N, alloc))
+	{
+		this->reserve(N);
+		this->assign(first, last);
+	}
+
+	//copy constructor: the copy uses its own inline storage, or goes straight to the heap
+	// when x does not fit in it.
+	small_vector (const small_vector & x)
+		: inline_storage<T, N>(), vector_type(inline_alloc_type(this->_inline_ptr(), N, x._alloc))
+	{
+		this->reserve((x.size() > N) ? x.size() : N);
+		this->assign(x.begin(), x.end());
+	}
+
+# ifdef FT_CXX11_
+	//move constructor: takes the heap storage of x, or moves its elements when x is inline.
+	small_vector (small_vector && x) noexcept
+		: inline_storage<T, N>(), vector_type(inline_alloc_type(this->_inline_ptr(), N, x._alloc))
+	{
+		this->reserve(N);
+		this->_take(x);
+	}
+# endif
+
+	~small_vector (void)
+	{
+	}
+
+	/////////////////////////
+	// Assignment operator //
+	/////////////////////////
+
+	small_vector & operator= (const small_vector & x)
+	{
+		vector_type::operator=(x);
+		return (*this);
+	}
+
+# ifdef FT_CXX11_
+	small_vector & operator= (small_vector && x) noexcept
+	{
+		if (this != &x)
+		{
+			small_vector	tmp(std::move(x));
+			this->swap(tmp);
+		}
+		return (*this);
+	}
+# endif
+
+	////////////////////////////////
+	// Members shared with vector //
+	////////////////////////////////
+
+	using		vector_type::begin;
+	using		vector_type::end;
+	using		vector_type::rbegin;
+	using		vector_type::rend;
+	using		vector_type::size;
+	using		vector_type::max_size;
+	using		vector_type::resize;
+	using		vector_type::resize_default_init;
+	using		vector_type::append_uninitialized;
+	using		vector_type::capacity;
+	using		vector_type::empty;
+	using		vector_type::reserve;
+	using		vector_type::operator[];
+	using		vector_type::at;
+	using		vector_type::front;
+	using		vector_type::back;
+	using		vector_type::data;
+	using		vector_type::assign;
+	using		vector_type::insert;
+	using		vector_type::erase;
+	using		vector_type::push_back;
+	using		vector_type::pop_back;
+	using		vector_type::clear;
+# ifdef FT_CXX11_
+	using		vector_type::emplace;
+	using		vector_type::emplace_back;
+# endif
+
+	// Returns a copy of the allocator used once the elements spill to the heap.
+	allocator_type get_allocator (void) const
+	{
+		return (this->_alloc);
+	}
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	// Returns whether the elements are held in the inline storage.
+	bool is_inline (void) const
+	{
+		return (this->_alloc.is_inline(this->_vct));
+	}
+
+	// Reduces the capacity to the size, or to the inline storage when the elements fit in it.
+	void shrink_to_fit (void)
+	{
+		if (this->_size <= N)
+		{
+			if (!this->is_inline())
+				this->_reallocate(N);
+		}
+		else if (this->_capacity > this->_size)
+			this->_reallocate(this->_size);
+	}
+
+	//////////////////////
+	// Common modifiers //
+	//////////////////////
+
+	// Exchanges the content of the container by the content of x. Heap storages are
+	// exchanged, inline elements are relocated into the other inline storage.
+	void swap (small_vector & x)
+	{
+		if (this == &x)
+			return ;
+		if (!this->is_inline() && !x.is_inline())
+		{
+			ft::swap(this->_vct, x._vct);
+			ft::swap(this->_size, x._size);
+			ft::swap(this->_capacity, x._capacity);
+			return ;
+		}
+
+		small_vector	tmp;
+
+		tmp._take(*this);
+		this->_take(x);
+		x._take(tmp);
+	}
+
+	///////////////////////
+	// Private functions //
+	///////////////////////
+private:
+	// take the elements of x, this must be empty and inline. A heap storage changes hands
+	// and x falls back to its inline storage, inline elements are relocated one by one.
+	// The inline buffer of this is never passed to deallocate, which could reach the heap.
+	void _take (small_vector & x)
+	{
+		if (x.is_inline())
+		{
+			this->_relocate(this->_vct, x._vct, x._size);
+			this->_size = x._size;
+			x._size = 0;
+		}
+		else
+		{
+			this->_alloc.release_inline();
+			this->_vct = x._vct;
+			this->_size = x._size;
+			this->_capacity = x._capacity;
+
+			x._vct = x._alloc.allocate(N);
+			x._size = 0;
+			x._capacity = N;
+		}
+	}
+}; // Small vector
+
+	template <class T, std::size_t N, class Alloc, class Growth>
+	const typename small_vector<T, N, Alloc, Growth>::size_type small_vector<T, N, Alloc, Growth>::inline_capacity;
+
+	//////////////////////////
+	// Relational operators //
+	//////////////////////////
+
+	template <class T, std::size_t N, class Alloc, class Growth>
+	bool operator== (const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs)
+	{
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, std::size_t N, class Alloc, class Growth>
+	bool operator< (const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, std::size_t N, class Alloc, class Growth>
+	bool operator!= (const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, std::size_t N, class Alloc, class Growth>
+	bool operator<= (const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, std::size_t N, class Alloc, class Growth>
+	bool operator> (const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, std::size_t N, class Alloc, class Growth>
+	bool operator>= (const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	//	Exchange contents of small vectors
+	template <class T, std::size_t N, class Alloc, class Growth>
+	void swap (small_vector<T, N, Alloc, Growth> & x, small_vector<T, N, Alloc, Growth> & y)
+	{
+		x.swap(y);
+	}
+
+} // Namespace ft
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef SPAN_HPP
+# define SPAN_HPP
+
+# include "vector.hpp"
+
+// non-owning view over contiguous storage
+//	A span is a pointer and a length: it refers to elements owned by someone else
+//	(a vector, an array, a slice of a buffer) and is copied by value in O(1).
+//	Taking a sub-range never allocates nor copies an element. The span does not
+//	keep the storage alive, any reallocation of the owner invalidates it.
+
+namespace ft
+{
+	// count meaning "up to the end of the span".
+	static const std::size_t	dynamic_extent = static_cast<std::size_t>(-1);
+
+	template <class T>
+	class span {
+	public:
+		/////////////////
+		// Member type //
+		/////////////////
+
+		typedef		T										element_type;
+		typedef		typename ft::remove_const<T>::type		value_type;
+		typedef		std::size_t								size_type;
+		typedef		std::ptrdiff_t							difference_type;
+		typedef		T *										pointer;
+		typedef		const T *								const_pointer;
+		typedef		T &										reference;
+		typedef		const T &								const_reference;
+		typedef		T *										iterator;			// contiguous, random access
+		typedef		ft::reverse_iterator<iterator>			reverse_iterator;
+
+		//////////////////////
+		// Member functions //
+		//////////////////////
+
+		// Empty span.
+		span (void) : _data(NULL), _size(0) {}
+
+		// The count elements starting at ptr. A template so that a literal count
+		// (span(ptr, 0)) is an exact match and not a null pointer for the overload below.
+		template <class Size>
+		span (pointer ptr, Size count, typename ft::enable_if<ft::is_integral<Size>::value, Size>::type* = 0)
+			: _data(ptr), _size(count) {}
+
+		// The elements of [first, last).
+		span (pointer first, pointer last) : _data(first), _size(last - first) {}
+
+		// All the elements of a vector, a span<const T> can view a const vector.
+		template <class U, class Alloc, class Growth>
+		span (vector<U, Alloc, Growth> & x) : _data(x.data()), _size(x.size()) {}
+
+		template <class U, class Alloc, class Growth>
+		span (const vector<U, Alloc, Growth> & x) : _data(x.data()), _size(x.size()) {}
+
+		// span<T> to span<const T>.
+		template <class U>
+		span (const span<U> & x) : _data(x.data()), _size(x.size()) {}
+
+		span (const span & x) : _data(x._data), _size(x._size) {}
+
+		span & operator= (const span & x)
+		{
+			_data = x._data;
+			_size = x._size;
+			return (*this);
+		}
+
+		~span (void) {}
+
+		///////////////
+		// Iterators //
+		///////////////
+
+		iterator begin (void) const
+		{
+			return (_data);
+		}
+
+		iterator end (void) const
+		{
+			return (_data + _size);
+		}
+
+		reverse_iterator rbegin (void) const
+		{
+			return (reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend (void) const
+		{
+			return (reverse_iterator(this->begin()));
+		}
+
+		///////////////////
+		// Member access //
+		///////////////////
+
+		// Like the containers the view gives no more access than its element type.
+		reference operator[] (size_type n) const
+		{
+			return (_data[n]);
+		}
+
+		reference front (void) const
+		{
+			return (_data[0]);
+		}
+
+		reference back (void) const
+		{
+			return (_data[_size - 1]);
+		}
+
+		pointer data (void) const
+		{
+			return (_data);
+		}
+
+		//////////////
+		// Capacity //
+		//////////////
+
+		size_type size (void) const
+		{
+			return (_size);
+		}
+
+		size_type size_bytes (void) const
+		{
+			return (_size * sizeof(element_type));
+		}
+
+		bool empty (void) const
+		{
+			return (_size == 0);
+		}
+
+		//////////////
+		// Subviews //
+		//////////////
+
+		// The first count elements, count must not exceed size().
+		span first (size_type count) const
+		{
+			return (span(_data, count));
+		}
+
+		// The last count elements, count must not exceed size().
+		span last (size_type count) const
+		{
+			return (span(_data + _size - count, count));
+		}
+
+		// The count elements starting at offset (all the remaining ones with dynamic_extent),
+		// offset must not exceed size() and offset + count must not exceed size().
+		span subspan (size_type offset, size_type count = dynamic_extent) const
+		{
+			if (count == dynamic_extent)
+				count = _size - offset;
+			return (span(_data + offset, count));
+		}
+
+	private:
+		pointer		_data;
+		size_type	_size;
+	};
+}
+
+#endif
@@ -2,18 +2,25 @@
 # define STACK_HPP
 
 # include "vector.hpp"
+# include "deque.hpp"
 
 
 //LIFO stack
 //	Stacks are a type of container adaptor, specifically designed to 
 //	operate in a LIFO context (last-in first-out), where elements are 
 //	inserted and extracted only from one end of the container.
-// in this case based on vector container.
+// in this case based on vector container, or on deque container when
+// FT_STACK_DEQUE_ is defined before the include: a deque never relocates
+// its elements, so a push costs at most one block allocation.
 
 namespace ft
 {
 
+# ifdef FT_STACK_DEQUE_
+template <class T, class Container = deque<T> >
+# else
 template <class T, class Container = vector<T> >
+# endif
 class stack {
 public:
 
@@ -83,6 +90,14 @@ public:
 		c.pop_back();
 	}
 
+	//	Gives the unused storage of the underlying container back, the stack keeps its elements.
+	//	This member function effectively calls the member function shrink_to_fit
+	//	of the underlying container object.
+	void shrink_to_fit (void)
+	{
+		c.shrink_to_fit();
+	}
+
 	///////////////////////
 	// Member variables //
 	//////////////////////
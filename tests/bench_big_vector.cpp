@@ -0,0 +1,92 @@
+#include <iostream>
+#include <new>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "../vector.hpp"
+#include "../includes/mmap_allocator.hpp"
+
+// fills, inserts into and walks a vector<char> of more than 2^31 elements,
+// every position and offset past INT_MAX has to go through size_type / difference_type.
+// mmap_allocator grows the block with mremap so the old and new buffers never coexist.
+
+#define BIG_COUNT ((1L << 31) + (1L << 24))
+#define GAP 4096
+
+typedef ft::vector<char, ft::mmap_allocator<char> >	big_vector;
+
+static double now (void)
+{
+	struct timeval	tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1e6);
+}
+
+static char value (long i)
+{
+	return ((char)(i % 127));
+}
+
+static void fail (const char * what)
+{
+	std::cout << "KO: " << what << std::endl;
+	exit(1);
+}
+
+int main (void)
+{
+	big_vector				vct;
+	double					start = now();
+
+	try
+	{
+		for (long i = 0; i < BIG_COUNT; i++)
+			vct.push_back(value(i));
+		std::cout << "push_back   " << vct.size() << " elements in " << now() - start << "s" << std::endl;
+
+		// insert a gap right before the end: the shifted tail sits past 2^31.
+		big_vector::size_type		pos = BIG_COUNT - (1L << 20);
+		start = now();
+		vct.insert(vct.begin() + pos, GAP, 'x');
+		std::cout << "insert      " << GAP << " elements at " << pos << " in " << now() - start << "s" << std::endl;
+	}
+	catch (std::bad_alloc &)
+	{
+		std::cout << "skipped: not enough memory for " << BIG_COUNT << " elements" << std::endl;
+		return (0);
+	}
+
+	big_vector::size_type			pos = BIG_COUNT - (1L << 20);
+	big_vector::difference_type		far = (big_vector::difference_type)pos + GAP;
+
+	if (vct.size() != (big_vector::size_type)BIG_COUNT + GAP)
+		fail("size");
+	if (vct.end() - vct.begin() != (big_vector::difference_type)vct.size())
+		fail("end - begin");
+	if (vct[pos] != 'x' || vct[pos + GAP - 1] != 'x' || vct[pos + GAP] != value(pos))
+		fail("operator[] past 2^31");
+	if (*(vct.begin() + far) != value(pos) || vct.begin()[far] != value(pos))
+		fail("iterator offset past 2^31");
+	if (*(vct.rbegin() + (vct.size() - 1)) != value(0))
+		fail("reverse_iterator offset past 2^31");
+
+	// one forward walk over the whole vector.
+	start = now();
+	long		sum = 0;
+	for (big_vector::const_iterator it = vct.begin(); it != vct.end(); ++it)
+		sum += *it;
+	std::cout << "iterate     " << vct.size() << " elements in " << now() - start << "s (sum " << sum << ")" << std::endl;
+
+	start = now();
+	vct.erase(vct.begin() + pos, vct.begin() + pos + GAP);
+	std::cout << "erase       " << GAP << " elements at " << pos << " in " << now() - start << "s" << std::endl;
+	if (vct.size() != (big_vector::size_type)BIG_COUNT || vct.back() != value(BIG_COUNT - 1) || vct[pos] != value(pos))
+		fail("erase past 2^31");
+
+	struct rusage		usage;
+	getrusage(RUSAGE_SELF, &usage);
+	std::cout << "peak MB     " << usage.ru_maxrss / 1024 << std::endl;
+	std::cout << "OK" << std::endl;
+	return (0);
+}
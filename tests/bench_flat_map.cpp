@@ -0,0 +1,66 @@
+#include <iostream>
+#include <iomanip>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include "../map.hpp"
+#include "../flat_map.hpp"
+
+// build, lookup and iteration times of ft::flat_map against ft::map on the same keys.
+// flat_map is built with one bulk insert, map one element at a time.
+
+#define KEY_COUNT 200000
+#define LOOKUP_COUNT 2000000
+#define ITERATION_COUNT 20
+
+static double now (void)
+{
+	struct timeval	tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1e6);
+}
+
+static void report (const char * name, const char * what, double time, long check)
+{
+	std::cout << std::left << std::setw(12) << name << std::setw(12) << what
+		<< std::setw(12) << time << check << std::endl;
+}
+
+template <class Map>
+void bench (const char * name, const ft::vector<ft::pair<int, int> > & keys, const ft::vector<int> & lookups)
+{
+	double		start = now();
+	Map			m(keys.begin(), keys.end());
+	report(name, "build", now() - start, m.size());
+
+	start = now();
+	long		found = 0;
+	for (ft::vector<int>::const_iterator it = lookups.begin(); it != lookups.end(); ++it)
+		found += (m.find(*it) != m.end());
+	report(name, "find", now() - start, found);
+
+	start = now();
+	long		sum = 0;
+	for (int i = 0; i < ITERATION_COUNT; i++)
+		for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+	report(name, "iterate", now() - start, sum);
+}
+
+int main (void)
+{
+	ft::vector<ft::pair<int, int> >		keys;
+	ft::vector<int>						lookups;
+
+	srand(123);
+	for (int i = 0; i < KEY_COUNT; i++)
+		keys.push_back(ft::make_pair(rand() % (KEY_COUNT * 4), i));
+	for (int i = 0; i < LOOKUP_COUNT; i++)
+		lookups.push_back(rand() % (KEY_COUNT * 4));
+
+	std::cout << std::left << std::setw(12) << "container" << std::setw(12) << "operation"
+		<< std::setw(12) << "seconds" << "check" << std::endl;
+	bench<ft::map<int, int> >("map", keys, lookups);
+	bench<ft::flat_map<int, int> >("flat_map", keys, lookups);
+	return (0);
+}
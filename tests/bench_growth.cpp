@@ -0,0 +1,79 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "../vector.hpp"
+#include "../includes/mmap_allocator.hpp"
+
+// push_back throughput and peak RSS of ft::vector for each growth policy.
+// every run happens in its own child process so the peak RSS is not shared.
+
+#define INT_COUNT 50000000
+#define BUFFER_COUNT 50000
+#define BUFFER_SIZE 4096
+struct Buffer
+{
+	int idx;
+	char buff[BUFFER_SIZE];
+};
+
+static double now (void)
+{
+	struct timeval	tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1e6);
+}
+
+template <class T, class Growth, class Alloc>
+void push (const char * name, long count)
+{
+	pid_t	pid = fork();
+
+	if (pid == 0)
+	{
+		ft::vector<T, Alloc, Growth>				vct;
+		T											val = T();
+		double										start = now();
+
+		for (long i = 0; i < count; i++)
+			vct.push_back(val);
+
+		double				time = now() - start;
+		struct rusage		usage;
+		getrusage(RUSAGE_SELF, &usage);
+
+		std::cout << std::left << std::setw(22) << name
+			<< std::setw(12) << count
+			<< std::setw(14) << vct.capacity()
+			<< std::setw(12) << usage.ru_maxrss / 1024
+			<< std::setw(12) << (long)(count / time / 1000) << std::endl;
+		exit(0);
+	}
+	waitpid(pid, NULL, 0);
+}
+
+template <class T>
+void bench (const char * type, long count)
+{
+	std::cout << "---- " << type << " ----" << std::endl;
+	std::cout << std::left << std::setw(22) << "policy" << std::setw(12) << "elements" << std::setw(14)
+		<< "capacity" << std::setw(12) << "peak MB" << std::setw(12) << "k push/s" << std::endl;
+	push<T, ft::growth_double, std::allocator<T> >("growth_double", count);
+	push<T, ft::growth_one_and_half, std::allocator<T> >("growth_one_and_half", count);
+	push<T, ft::growth_rounded, std::allocator<T> >("growth_rounded", count);
+	push<T, ft::growth_capped<>, std::allocator<T> >("growth_capped<64MB>", count);
+	push<T, ft::growth_double, ft::mmap_allocator<T> >("double + mmap", count);
+	push<T, ft::growth_capped<>, ft::mmap_allocator<T> >("capped + mmap", count);
+}
+
+int main (void)
+{
+	bench<int>("int", INT_COUNT);
+	bench<Buffer>("Buffer (4KB)", BUFFER_COUNT);
+	return (0);
+}
@@ -0,0 +1,171 @@
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include "../map.hpp"
+
+// moving entries between two maps, and changing their key: erase and insert a copy
+// (std::map, ft::map) against ft::map node handles (extract and insert) and merge.
+// the mapped values are strings long enough to live on the heap, so a copy allocates.
+
+#define KEY_COUNT 200000
+#define ROUNDS 2
+
+typedef std::map<int, std::string>		std_map;
+typedef ft::map<int, std::string>		ft_map;
+
+static double now (void)
+{
+	struct timeval	tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1e6);
+}
+
+static void report (const char * name, const char * what, double time, long check)
+{
+	std::cout << std::left << std::setw(10) << name << std::setw(20) << what
+		<< std::setw(12) << time << check << std::endl;
+}
+
+template <class Map>
+void fill (Map & m, const std::vector<int> & keys)
+{
+	for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		m.insert(typename Map::value_type(*it, std::string(40, 'a' + *it % 26)));
+}
+
+// every round moves all the entries from one shard to the other and back.
+template <class Map>
+void move_copy (const char * name, const std::vector<int> & keys)
+{
+	Map			a;
+	Map			b;
+
+	fill(a, keys);
+
+	double		start = now();
+
+	for (int i = 0; i < ROUNDS; i++)
+	{
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		{
+			typename Map::iterator	found = a.find(*it);
+
+			b.insert(*found);
+			a.erase(found);
+		}
+		a.swap(b);
+	}
+	report(name, "move erase+insert", now() - start, a.size());
+}
+
+static void move_extract (const std::vector<int> & keys)
+{
+	ft_map		a;
+	ft_map		b;
+
+	fill(a, keys);
+
+	double		start = now();
+
+	for (int i = 0; i < ROUNDS; i++)
+	{
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+			b.insert(a.extract(*it));
+		a.swap(b);
+	}
+	report("ft::map", "move extract", now() - start, a.size());
+}
+
+static void move_merge (const std::vector<int> & keys)
+{
+	ft_map		a;
+	ft_map		b;
+
+	fill(a, keys);
+
+	double		start = now();
+
+	for (int i = 0; i < ROUNDS; i++)
+	{
+		b.merge(a);
+		a.swap(b);
+	}
+	report("ft::map", "move merge", now() - start, a.size());
+}
+
+// every round moves each key to key + KEY_COUNT, then back.
+template <class Map>
+void rekey_copy (const char * name, const std::vector<int> & keys)
+{
+	Map			m;
+
+	fill(m, keys);
+
+	double		start = now();
+
+	for (int i = 0; i < ROUNDS * 2; i++)
+	{
+		int		shift = (i % 2) ? -KEY_COUNT : KEY_COUNT;
+		int		base = (i % 2) ? KEY_COUNT : 0;
+
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		{
+			typename Map::iterator	found = m.find(*it + base);
+
+			m.insert(typename Map::value_type(found->first + shift, found->second));
+			m.erase(found);
+		}
+	}
+	report(name, "rekey erase+insert", now() - start, m.size());
+}
+
+static void rekey_extract (const std::vector<int> & keys)
+{
+	ft_map		m;
+
+	fill(m, keys);
+
+	double		start = now();
+
+	for (int i = 0; i < ROUNDS * 2; i++)
+	{
+		int		shift = (i % 2) ? -KEY_COUNT : KEY_COUNT;
+		int		base = (i % 2) ? KEY_COUNT : 0;
+
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		{
+			ft_map::node_type	nh = m.extract(*it + base);
+
+			nh.key() += shift;
+			m.insert(nh);
+		}
+	}
+	report("ft::map", "rekey extract", now() - start, m.size());
+}
+
+int main (void)
+{
+	std::vector<int>	keys;
+
+	srand(123);
+	for (int i = 0; i < KEY_COUNT; i++)
+		keys.push_back(i);
+	for (int i = KEY_COUNT - 1; i > 0; i--)
+		std::swap(keys[i], keys[rand() % (i + 1)]);
+
+	std::cout << std::left << std::setw(10) << "container" << std::setw(20) << "operation"
+		<< std::setw(12) << "seconds" << "check" << std::endl;
+	move_copy<std_map>("std::map", keys);
+	move_copy<ft_map>("ft::map", keys);
+	move_extract(keys);
+	move_merge(keys);
+	rekey_copy<std_map>("std::map", keys);
+	rekey_copy<ft_map>("ft::map", keys);
+	rekey_extract(keys);
+	return (0);
+}
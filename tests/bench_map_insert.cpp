@@ -0,0 +1,157 @@
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include "../map.hpp"
+
+// load time of ft::map against std::map for sorted, reverse-sorted and random keys.
+// sorted keys are hinted at end(), reverse-sorted keys at begin(), random keys at end()
+// (where the hint is mostly wrong), and the range constructor is fed the sorted keys.
+// destroy times the destructor of the map loaded with the random keys.
+// merge inserts a sorted batch of odd keys into a map of even keys: ft::map is told
+// the batch is sorted (ft::sorted_unique), std::map gets a plain range insert.
+// every load runs in its own child process so the heap left by one does not slow the next.
+
+#define KEY_COUNT 1000000
+
+static double now (void)
+{
+	struct timeval	tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1e6);
+}
+
+template <class Map>
+void load (const char * name, const char * what, const std::vector<int> & keys, bool at_begin)
+{
+	pid_t	pid = fork();
+
+	if (pid == 0)
+	{
+		Map			m;
+		double		start = now();
+
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+			m.insert(at_begin ? m.begin() : m.end(), typename Map::value_type(*it, *it));
+		std::cout << std::left << std::setw(10) << name << std::setw(16) << what
+			<< std::setw(12) << now() - start << m.size() << std::endl;
+		exit(0);
+	}
+	waitpid(pid, NULL, 0);
+}
+
+template <class Map>
+void range (const char * name, const std::vector<typename Map::value_type> & values)
+{
+	pid_t	pid = fork();
+
+	if (pid == 0)
+	{
+		double		start = now();
+		Map			m(values.begin(), values.end());
+
+		std::cout << std::left << std::setw(10) << name << std::setw(16) << "range sorted"
+			<< std::setw(12) << now() - start << m.size() << std::endl;
+		exit(0);
+	}
+	waitpid(pid, NULL, 0);
+}
+
+template <class Map>
+void destroy (const char * name, const std::vector<int> & keys)
+{
+	pid_t	pid = fork();
+
+	if (pid == 0)
+	{
+		Map *		m = new Map;
+
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+			m->insert(typename Map::value_type(*it, *it));
+
+		double		start = now();
+		delete m;
+		std::cout << std::left << std::setw(10) << name << std::setw(16) << "destroy random"
+			<< std::setw(12) << now() - start << keys.size() << std::endl;
+		exit(0);
+	}
+	waitpid(pid, NULL, 0);
+}
+
+template <class Map, class Iterator>
+void merge_into (Map & m, Iterator first, Iterator last)
+{
+	m.insert(first, last);
+}
+
+template <class Key, class T, class Iterator>
+void merge_into (ft::map<Key, T> & m, Iterator first, Iterator last)
+{
+	m.insert(ft::sorted_unique, first, last);
+}
+
+template <class Map>
+void merge (const char * name, const std::vector<typename Map::value_type> & values)
+{
+	pid_t	pid = fork();
+
+	if (pid == 0)
+	{
+		std::vector<typename Map::value_type>	odd;
+
+		for (typename std::vector<typename Map::value_type>::const_iterator it = values.begin(); it != values.end(); ++it)
+			odd.push_back(typename Map::value_type(it->first + 1, it->second));
+
+		Map			m(values.begin(), values.end());
+		double		start = now();
+
+		merge_into(m, odd.begin(), odd.end());
+		std::cout << std::left << std::setw(10) << name << std::setw(16) << "merge sorted"
+			<< std::setw(12) << now() - start << m.size() << std::endl;
+		exit(0);
+	}
+	waitpid(pid, NULL, 0);
+}
+
+template <class Map>
+void bench (const char * name, const std::vector<int> & sorted, const std::vector<int> & reversed,
+const std::vector<int> & random)
+{
+	std::vector<typename Map::value_type>	values;
+
+	for (std::vector<int>::const_iterator it = sorted.begin(); it != sorted.end(); ++it)
+		values.push_back(typename Map::value_type(*it, *it));
+	load<Map>(name, "hinted sorted", sorted, false);
+	load<Map>(name, "hinted reverse", reversed, true);
+	load<Map>(name, "hinted random", random, false);
+	range<Map>(name, values);
+	merge<Map>(name, values);
+	destroy<Map>(name, random);
+}
+
+int main (void)
+{
+	std::vector<int>	sorted;
+	std::vector<int>	reversed;
+	std::vector<int>	random;
+
+	srand(123);
+	for (int i = 0; i < KEY_COUNT; i++)
+		sorted.push_back(i * 2);
+	reversed.assign(sorted.rbegin(), sorted.rend());
+	random = sorted;
+	for (int i = KEY_COUNT - 1; i > 0; i--)
+		std::swap(random[i], random[rand() % (i + 1)]);
+
+	std::cout << std::left << std::setw(10) << "container" << std::setw(16) << "load"
+		<< std::setw(12) << "seconds" << "size" << std::endl;
+	bench<std::map<int, int> >("std::map", sorted, reversed, random);
+	bench<ft::map<int, int> >("ft::map", sorted, reversed, random);
+	return (0);
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <vector>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include "../map.hpp"
+
+// iteration costs of ft::map against std::map: forward and reverse scans, and a
+// queue-like loop which reads and erases begin() until the map is empty.
+// scans run over a small map (in cache, the step itself is measured) and a large one.
+
+#define SMALL_COUNT 1000
+#define SMALL_SCANS 20000
+#define LARGE_COUNT 1000000
+#define LARGE_SCANS 10
+#define POP_COUNT 1000000
+
+static double now (void)
+{
+	struct timeval	tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1e6);
+}
+
+static void report (const char * name, const char * what, double time, long check)
+{
+	std::cout << std::left << std::setw(10) << name << std::setw(16) << what
+		<< std::setw(12) << time << check << std::endl;
+}
+
+template <class Map>
+void scan (const char * name, const char * what, const std::vector<int> & keys, int scans)
+{
+	Map			m;
+
+	for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		m.insert(typename Map::value_type(*it, *it));
+
+	double		start = now();
+	long		sum = 0;
+
+	for (int i = 0; i < scans; i++)
+		for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+	report(name, what, now() - start, sum);
+
+	start = now();
+	sum = 0;
+	for (int i = 0; i < scans; i++)
+		for (typename Map::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+			sum += it->second;
+	report(name, "reverse", now() - start, sum);
+}
+
+template <class Map>
+void pop (const char * name, const std::vector<int> & keys)
+{
+	Map			m;
+
+	for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		m.insert(typename Map::value_type(*it, *it));
+
+	double		start = now();
+	long		sum = 0;
+
+	while (!m.empty())
+	{
+		sum += m.begin()->second;
+		m.erase(m.begin());
+	}
+	report(name, "pop begin()", now() - start, sum);
+}
+
+template <class Map>
+void bench (const char * name, const std::vector<int> & small, const std::vector<int> & large)
+{
+	scan<Map>(name, "scan small", small, SMALL_SCANS);
+	scan<Map>(name, "scan large", large, LARGE_SCANS);
+	pop<Map>(name, large);
+}
+
+int main (void)
+{
+	std::vector<int>	small;
+	std::vector<int>	large;
+
+	srand(123);
+	for (int i = 0; i < SMALL_COUNT; i++)
+		small.push_back(rand());
+	for (int i = 0; i < LARGE_COUNT; i++)
+		large.push_back(rand());
+
+	std::cout << std::left << std::setw(10) << "container" << std::setw(16) << "operation"
+		<< std::setw(12) << "seconds" << "check" << std::endl;
+	bench<std::map<int, int> >("std::map", small, large);
+	bench<ft::map<int, int> >("ft::map", small, large);
+	return (0);
+}
@@ -0,0 +1,57 @@
+#include <iostream>
+#include <iomanip>
+#include <stdlib.h>
+#ifdef __GLIBC__
+# include <malloc.h>
+#endif
+
+#include "../map.hpp"
+
+// heap bytes per element of a map<int, int>, with std::allocator and with ft::node_pool.
+// build it with and without FT_MAP_COMPACT_NODES to compare the two node layouts.
+
+#define KEY_COUNT 1000000
+
+typedef ft::map<int, int>																	heap_map;
+typedef ft::map<int, int, std::less<int>, ft::node_pool<ft::pair<const int, int> > >		pool_map;
+
+// bytes currently handed out by malloc, 0 when it cannot be asked.
+static std::size_t heap_in_use (void)
+{
+#ifdef __GLIBC__
+	return (mallinfo2().uordblks);
+#else
+	return (0);
+#endif
+}
+
+template <class Map>
+void bench (const char * name)
+{
+	std::size_t		before = heap_in_use();
+	Map *			m = new Map;
+
+	for (int i = 0; i < KEY_COUNT; i++)
+		m->insert(typename Map::value_type(rand(), i));
+
+	double			used = heap_in_use() - before;
+
+	std::cout << std::left << std::setw(16) << name << std::setw(12) << sizeof(typename Map::node)
+		<< std::setw(16) << used / m->size() << m->size() << std::endl;
+	delete m;
+}
+
+int main (void)
+{
+	srand(123);
+#ifdef FT_MAP_COMPACT_NODES
+	std::cout << "compact nodes" << std::endl;
+#else
+	std::cout << "default nodes" << std::endl;
+#endif
+	std::cout << std::left << std::setw(16) << "allocator" << std::setw(12) << "node bytes"
+		<< std::setw(16) << "heap bytes/elem" << "size" << std::endl;
+	bench<heap_map>("std::allocator");
+	bench<pool_map>("node_pool");
+	return (0);
+}
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include "../map.hpp"
+
+// insert, lookup, iteration, clear and destruction times of ft::map with std::allocator
+// against ft::node_pool, with and without reserve(). Keys are inserted in random order,
+// and again after clear().
+// every run is in its own child process so the heap left by one does not slow the next.
+
+#define KEY_COUNT 1000000
+#define ITERATION_COUNT 10
+
+typedef ft::map<int, int>																	heap_map;
+typedef ft::map<int, int, std::less<int>, ft::node_pool<ft::pair<const int, int> > >		pool_map;
+
+static double now (void)
+{
+	struct timeval	tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1e6);
+}
+
+static void report (const char * name, const char * what, double time, long check)
+{
+	std::cout << std::left << std::setw(16) << name << std::setw(12) << what
+		<< std::setw(12) << time << check << std::endl;
+}
+
+template <class Map>
+void bench (const char * name, const std::vector<int> & keys, bool reserve)
+{
+	pid_t	pid = fork();
+
+	if (pid == 0)
+	{
+		Map *		m = new Map;
+		double		start = now();
+
+		if (reserve)
+			m->reserve(keys.size());
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+			m->insert(typename Map::value_type(*it, *it));
+		report(name, "insert", now() - start, m->size());
+
+		start = now();
+		long		found = 0;
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+			found += (m->find(*it) != m->end());
+		report(name, "find", now() - start, found);
+
+		start = now();
+		long		sum = 0;
+		for (int i = 0; i < ITERATION_COUNT; i++)
+			for (typename Map::const_iterator it = m->begin(); it != m->end(); ++it)
+				sum += it->second;
+		report(name, "iterate", now() - start, sum);
+
+		start = now();
+		m->clear();
+		report(name, "clear", now() - start, m->size());
+
+		start = now();
+		for (std::vector<int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+			m->insert(typename Map::value_type(*it, *it));
+		report(name, "refill", now() - start, m->size());
+
+		start = now();
+		delete m;
+		report(name, "destroy", now() - start, keys.size());
+		exit(0);
+	}
+	waitpid(pid, NULL, 0);
+}
+
+int main (void)
+{
+	std::vector<int>	keys;
+
+	srand(123);
+	for (int i = 0; i < KEY_COUNT; i++)
+		keys.push_back(i);
+	for (int i = KEY_COUNT - 1; i > 0; i--)
+		std::swap(keys[i], keys[rand() % (i + 1)]);
+
+	std::cout << std::left << std::setw(16) << "allocator" << std::setw(12) << "operation"
+		<< std::setw(12) << "seconds" << "check" << std::endl;
+	bench<heap_map>("std::allocator", keys, false);
+	bench<pool_map>("node_pool", keys, false);
+	bench<pool_map>("node_pool+res", keys, true);
+	return (0);
+}
@@ -0,0 +1,116 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../small_vector.hpp"
+
+#define INLINE 8
+
+typedef ft::small_vector<int, INLINE>			int_vector;
+typedef ft::small_vector<std::string, INLINE>	str_vector;
+
+template <class V>
+bool is_inline (const V & v)
+{
+	return (v.is_inline());
+}
+
+template <class V>
+void shrink_to_fit (V & v)
+{
+	v.shrink_to_fit();
+}
+
+static int int_value (int i)
+{
+	return (i);
+}
+
+static std::string str_value (int i)
+{
+	std::ostringstream	out;
+	out << "str" << i;
+	return (out.str());
+}
+
+template <class V>
+void print (const std::string & title, const V & v)
+{
+	std::cout << title << " (" << v.size() << (is_inline(v) ? ", inline" : ", heap") << "):";
+	for (typename V::const_iterator it = v.begin(); it != v.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
+template <class V>
+void test (const std::string & name, typename V::value_type (*value)(int))
+{
+	V	a;
+
+	for (int i = 0; i < 5; i++)
+		a.push_back(value(i));
+	print(name + " inline", a);
+	for (int i = 5; i < 25; i++)
+		a.push_back(value(i));
+	print(name + " spilled", a);
+
+	V	heap_copy(a);
+	V	small;
+
+	small.push_back(value(100));
+	small.push_back(value(101));
+	small.insert(small.begin() + 1, value(102));
+
+	V	small_copy(small);
+
+	print(name + " heap copy", heap_copy);
+	print(name + " inline copy", small_copy);
+
+	V	assigned;
+
+	assigned.push_back(value(7));
+	assigned = a;
+	print(name + " assigned from heap", assigned);
+	assigned = small;
+	print(name + " assigned from inline", assigned);
+
+	V	s1(small);
+	V	s2(3, value(50));
+
+	s1.swap(s2);
+	print(name + " swap inline/inline", s1);
+	print(name + " swap inline/inline", s2);
+	heap_copy.erase(heap_copy.begin(), heap_copy.begin() + 10);
+	a.swap(heap_copy);
+	print(name + " swap heap/heap", a);
+	print(name + " swap heap/heap", heap_copy);
+	s1.swap(a);
+	print(name + " swap inline/heap", s1);
+	print(name + " swap inline/heap", a);
+	swap(a, s1);
+	print(name + " swap heap/inline", s1);
+	print(name + " swap heap/inline", a);
+
+	a.erase(a.begin() + 2, a.end());
+	shrink_to_fit(a);
+	print(name + " shrunk to inline", a);
+	a.insert(a.begin() + 1, 10, value(9));
+	shrink_to_fit(a);
+	print(name + " shrunk on heap", a);
+	a.resize(4);
+	shrink_to_fit(a);
+	a.push_back(value(200));
+	print(name + " back inline", a);
+
+	std::cout << name << " compare " << (s2 == small) << (s2 != small) << (small < a) << (a <= small)
+		<< (a > small) << (a >= a) << std::endl;
+}
+
+int main(int argc, char** argv) {
+	(void)argc;
+	(void)argv;
+
+	test<int_vector>("int", int_value);
+	test<str_vector>("string", str_value);
+	return (0);
+}
@@ -0,0 +1,111 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../span.hpp"
+
+typedef ft::span<int>					int_span;
+typedef ft::span<const int>				const_int_span;
+typedef ft::span<std::string>			str_span;
+
+// the storage of a vector, through vector::data().
+template <class V>
+typename V::value_type * data (V & v)
+{
+	return (v.data());
+}
+
+template <class V>
+const typename V::value_type * data (const V & v)
+{
+	return (v.data());
+}
+
+// a view walked forwards, then backwards.
+template <class S>
+void print_span (const std::string & title, const S & s)
+{
+	std::cout << title << " (" << s.size() << "," << s.size_bytes() << "," << s.empty() << "):";
+	for (typename S::iterator it = s.begin(); it != s.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << " |";
+	for (typename S::reverse_iterator it = s.rbegin(); it != s.rend(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
+int main(int argc, char** argv) {
+	(void)argc;
+	(void)argv;
+	ft::vector<int>				vector_int;
+	ft::vector<std::string>		vector_str;
+
+	for (int i = 0; i < 20; i++)
+		vector_int.push_back(i * 10);
+	for (int i = 0; i < 6; i++)
+	{
+		std::ostringstream	str;
+		str << "str" << i;
+		vector_str.push_back(str.str());
+	}
+
+	const ft::vector<int> &		const_vector = vector_int;
+	int_span					all(vector_int);
+	int_span					counted(data(vector_int) + 2, 5);
+	int_span					paired(data(vector_int) + 5, data(vector_int) + 12);
+	int_span					none(data(vector_int), 0);
+	int_span					nothing;
+	const_int_span				const_all(const_vector);
+	const_int_span				converted(counted);
+	str_span					strings(vector_str);
+
+	std::cout << "construction" << std::endl;
+	print_span("vector", all);
+	print_span("pointer and count", counted);
+	print_span("pointer pair", paired);
+	print_span("pointer and zero", none);
+	print_span("default", nothing);
+	print_span("const vector", const_all);
+	print_span("to const", converted);
+	print_span("strings", strings);
+	std::cout << all.front() << " " << all.back() << " " << counted[4] << " " << paired.back() << " " << strings[3] << std::endl;
+
+	std::cout << "subviews" << std::endl;
+	print_span("first 3", all.first(3));
+	print_span("first 0", all.first(0));
+	print_span("first all", all.first(all.size()));
+	print_span("last 4", all.last(4));
+	print_span("last 0", all.last(0));
+	print_span("subspan 15", all.subspan(15));
+	print_span("subspan 0", all.subspan(0));
+	print_span("subspan at the end", all.subspan(all.size()));
+	print_span("subspan 3 4", all.subspan(3, 4));
+	print_span("subspan 0 0", all.subspan(0, 0));
+	print_span("subspan end 0", all.subspan(all.size(), 0));
+	print_span("subspan of a subspan", paired.subspan(2).first(3).last(2));
+	print_span("strings last 2", strings.last(2));
+
+	std::cout << "same storage" << std::endl;
+	std::cout << (all.data() == data(vector_int)) << " " << (&all[7] == &vector_int[7]) << " "
+		<< (counted.data() == data(vector_int) + 2) << " " << (paired.begin() == &vector_int[5]) << " "
+		<< (paired.end() == &vector_int[12]) << " " << (const_all.data() == data(const_vector)) << " "
+		<< (strings.data() == data(vector_str)) << std::endl;
+
+	all[0] = -1;
+	counted.back() = -2;
+	paired.front() = -3;
+	for (int_span::iterator it = all.subspan(15).begin(); it != all.end(); ++it)
+		*it += 1000;
+	for (int_span::reverse_iterator it = all.first(3).rbegin(); it != all.first(3).rend(); ++it)
+		*it += 1;
+	strings.subspan(1, 2).front() += "!";
+	std::cout << "written through the views" << std::endl;
+	for (size_t i = 0; i < vector_int.size(); i++)
+		std::cout << " " << vector_int[i];
+	std::cout << std::endl;
+	for (size_t i = 0; i < vector_str.size(); i++)
+		std::cout << " " << vector_str[i];
+	std::cout << std::endl;
+	print_span("const view of the writes", const_all.subspan(0, 6));
+	return (0);
+}
@@ -1,9 +1,356 @@
 #include <iostream>
 #include <string>
 #include <deque>
+#include <sstream>
+#include <list>
+#include <iterator>
+#if __cplusplus >= 201103L
+# include <memory>
+#endif
 #include <stdlib.h>
 
 #include "../vector.hpp"
+#include "../includes/mmap_allocator.hpp"
+
+// values of the element types the tests are run with.
+template <class T>
+T value (int i);
+
+template <>
+int value<int> (int i)
+{
+	return (i);
+}
+
+template <>
+std::string value<std::string> (int i)
+{
+	std::ostringstream	out;
+	out << "str" << i;
+	return (out.str());
+}
+
+// ft::vector extensions, std_vector.cpp spells them with resize.
+template <class V>
+typename V::value_type * append_uninitialized (V & v, typename V::size_type n)
+{
+	return (v.append_uninitialized(n));
+}
+
+template <class V>
+void resize_default_init (V & v, typename V::size_type n)
+{
+	v.resize_default_init(n);
+}
+
+template <class V>
+void shrink_to_fit (V & v)
+{
+	v.shrink_to_fit();
+}
+
+// vectors growing under each growth policy, std_vector.cpp has only std::vector.
+template <class T>
+struct grown
+{
+	typedef ft::vector<T, std::allocator<T>, ft::growth_one_and_half>	one_and_half;
+	typedef ft::vector<T, std::allocator<T>, ft::growth_rounded>		rounded;
+	typedef ft::vector<T, std::allocator<T>, ft::growth_capped<256> >	capped;
+};
+
+// capacities picked from empty, from one element, for a request far above the size,
+// and around the Limit of growth_capped.
+template <class Growth>
+void print_grow (const std::string & name)
+{
+	typedef std::allocator<int>	A;
+
+	std::cout << name << " " << Growth::template grow<A>(0, 1) << " " << Growth::template grow<A>(1, 2)
+		<< " " << Growth::template grow<A>(10, 1000) << " " << Growth::template grow<A>(100, 101)
+		<< " " << Growth::template grow<A>(16, 17) << " " << Growth::template grow<A>(17, 18)
+		<< " " << Growth::template grow<A>(32, 33) << std::endl;
+}
+
+void test_growth_edges (void)
+{
+	print_grow<ft::growth_double>("growth_double");
+	print_grow<ft::growth_one_and_half>("growth_one_and_half");
+	print_grow<ft::growth_rounded>("growth_rounded");
+	print_grow<ft::growth_capped<64> >("growth_capped<64>");
+	print_grow<ft::growth_capped<2> >("growth_capped<2>");
+}
+
+// vectors in mmap'ed storage, std_vector.cpp has only std::vector.
+template <class T>
+struct mapped
+{
+	typedef ft::vector<T, ft::mmap_allocator<T> >	type;
+};
+
+// vectors giving storage back with ft::release_below. std::vector never does, std_vector.cpp
+// prints the capacity each step must leave.
+template <class T>
+struct released
+{
+	typedef ft::vector<T, std::allocator<T>, ft::release_below<> >	type;
+};
+
+template <class V>
+std::size_t released_capacity (const V & v, std::size_t)
+{
+	return (v.capacity());
+}
+
+template <class V>
+void print_vector (const std::string & title, const V & v)
+{
+	std::cout << title << " (" << v.size() << "):";
+	for (typename V::const_iterator it = v.begin(); it != v.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
+// single-pass gap: fill and range inserts in the middle and at both ends, with and
+// without room left, range erases, and inserts of the vector's own elements.
+// V is the vector type, so that the checks run under every growth policy.
+template <class V>
+void test_gap (const std::string & name)
+{
+	typedef typename V::value_type	T;
+
+	V				v;
+	std::list<T>	l;
+
+	for (int i = 0; i < 10; i++)
+		v.push_back(value<T>(i));
+	for (int i = 0; i < 5; i++)
+		l.push_back(value<T>(100 + i));
+	v.insert(v.begin() + 3, 4, value<T>(50));
+	v.insert(v.begin(), l.begin(), l.end());
+	v.insert(v.end(), l.begin(), l.end());
+	v.insert(v.begin() + 7, v[2]);
+	v.insert(v.begin() + 1, 3, v.back());
+	print_vector(name + " insert", v);
+
+	v.reserve(v.size() + 100);
+	v.insert(v.begin() + 5, l.begin(), l.end());
+	v.insert(v.begin() + 2, 20, value<T>(7));
+	v.insert(v.end() - 1, v.front());
+	v.insert(v.begin() + 4, 2, v[30]);
+	print_vector(name + " insert in place", v);
+
+	v.erase(v.begin() + 4, v.begin() + 30);
+	v.erase(v.begin() + 2, v.begin() + 2);
+	v.erase(v.end() - 3, v.end());
+	v.erase(v.begin());
+	print_vector(name + " range erase", v);
+
+	// a copy is full: inserting itself reallocates, then there is room for the others.
+	V	w(v);
+
+	w.insert(w.begin(), w.begin(), w.end());
+	print_vector(name + " self insert", w);
+	w.reserve(w.size() * 3);
+	w.insert(w.end(), w.begin(), w.end());
+	w.insert(w.begin() + 10, w.begin(), w.begin() + 4);
+	print_vector(name + " self insert in place", w);
+
+	V	big;
+
+	for (int i = 0; i < 100000; i++)
+		big.push_back(value<T>(i));
+	big.insert(big.begin() + 5000, v.begin(), v.end());
+	big.insert(big.begin() + 70000, big.begin() + 10, big.begin() + 60010);
+	big.erase(big.begin() + 100, big.end() - 100);
+	std::cout << name << " splice " << big.size() << " " << big[99] << " " << big[100] << " " << big.back() << std::endl;
+}
+
+// mmap'ed storage: ints grow and shrink through reallocate(), which keeps the mapping
+// when the page count does not change, strings cannot be moved as raw bytes and are
+// relocated into a new mapping.
+template <class T>
+void test_mapped (const std::string & name)
+{
+	typename mapped<T>::type	v;
+
+	for (int i = 0; i < 5000; i++)
+		v.push_back(value<T>(i));
+	std::cout << name << " mapped " << v.size() << " " << v[1023] << " " << v[1024] << " " << v.back() << std::endl;
+	v.insert(v.begin() + 1000, 3000, value<T>(-1));
+	typename mapped<T>::type	part(v.begin() + 4990, v.begin() + 5010);
+
+	v.insert(v.begin() + 3, part.begin(), part.end());
+	v.erase(v.begin() + 10, v.begin() + 7000);
+	print_vector(name + " mapped insert and erase", v);
+	v.resize(100);
+	shrink_to_fit(v);
+	v.reserve(101);
+	v.reserve(1000);
+	for (int i = 0; i < 900; i++)
+		v.push_back(value<T>(-i));
+	std::cout << name << " mapped shrink and regrow " << v.size() << " " << v[99] << " " << v[100] << " " << v.back() << std::endl;
+
+	typename mapped<T>::type	copy(v);
+
+	v.clear();
+	shrink_to_fit(v);
+	v.push_back(value<T>(7));
+	std::cout << name << " mapped copy " << copy.size() << " " << copy[500] << " " << v.size() << " " << v[0] << std::endl;
+}
+
+// shrink_to_fit, and release_below: the storage shrinks once the size falls below a quarter
+// of the capacity, not before, goes back and forth around the shrink point without
+// reallocating, and is released when the vector empties.
+void test_release (void)
+{
+	ft::vector<int>		plain(1000, 3);
+
+	plain.erase(plain.begin() + 10, plain.end());
+	std::cout << "shrink_to_fit " << plain.capacity();
+	shrink_to_fit(plain);
+	std::cout << " " << plain.capacity() << " " << plain.size() << " " << plain.back();
+	plain.clear();
+	shrink_to_fit(plain);
+	std::cout << " " << plain.capacity() << std::endl;
+
+	released<int>::type	v;
+
+	for (int i = 0; i < 1000; i++)
+		v.push_back(i);
+	while (v.size() > 256)
+		v.pop_back();
+	std::cout << "release pop burst " << released_capacity(v, 1024);
+	v.pop_back();
+	std::cout << " " << released_capacity(v, 510);
+	while (v.size() > 64)
+		v.pop_back();
+	std::cout << " " << released_capacity(v, 254);
+	v.pop_back();
+	std::cout << " " << released_capacity(v, 126) << " " << v.size() << " " << v.back() << std::endl;
+
+	const int *		storage = &v[0];
+
+	for (int i = 0; i < 1000; i++)
+	{
+		v.push_back(i);
+		v.pop_back();
+	}
+	std::cout << "release at the threshold " << released_capacity(v, 126) << " " << (&v[0] == storage) << " " << v.size() << std::endl;
+	v.erase(v.begin() + 10, v.end());
+	std::cout << "release erase " << released_capacity(v, 20) << " " << v.back();
+	v.resize(8);
+	std::cout << " " << released_capacity(v, 20);
+	v.clear();
+	std::cout << " " << released_capacity(v, 0) << " " << v.empty();
+	v.push_back(5);
+	std::cout << " " << released_capacity(v, 1) << " " << v.front() << std::endl;
+
+	released<std::string>::type	s(100, "released");
+
+	s.erase(s.begin(), s.begin() + 90);
+	std::cout << "release strings " << released_capacity(s, 20) << " " << s.size() << " " << s.back() << std::endl;
+}
+
+// default-init growth: ints are left as they are and written through the returned
+// pointer, strings are default constructed.
+void test_default_init (void)
+{
+	ft::vector<int>		v;
+	int *				p = append_uninitialized(v, 1000);
+
+	for (int i = 0; i < 1000; i++)
+		p[i] = i * 3;
+	p = append_uninitialized(v, 5);
+	for (int i = 0; i < 5; i++)
+		p[i] = -i;
+	resize_default_init(v, 10);
+	resize_default_init(v, 12);
+	v[10] = 42;
+	v[11] = 43;
+	print_vector("append_uninitialized", v);
+
+	ft::vector<std::string>	s(3, "abc");
+	std::string *			q = append_uninitialized(s, 4);
+
+	std::cout << "default init strings " << s.size() << " " << q[0].size() << " " << s[2] << std::endl;
+	q[3] = "last";
+	resize_default_init(s, 5);
+	resize_default_init(s, 9);
+	print_vector("resize_default_init", s);
+}
+
+// ranges of every iterator category: istream_iterator can only be read once, list
+// iterators are walked to be counted, pointers are counted in O(1).
+void test_iterator_categories (void)
+{
+	std::istringstream					ints("1 2 3 4 5 6 7 8 9 10 11 12");
+	ft::vector<int>						v((std::istream_iterator<int>(ints)), std::istream_iterator<int>());
+
+	print_vector("istream construct", v);
+
+	std::istringstream					more("20 21 22");
+	std::istringstream					tail("30 31");
+
+	v.insert(v.begin() + 4, std::istream_iterator<int>(more), std::istream_iterator<int>());
+	v.insert(v.end(), std::istream_iterator<int>(tail), std::istream_iterator<int>());
+	print_vector("istream insert", v);
+
+	std::istringstream					words("alpha beta gamma delta");
+	ft::vector<std::string>				s(5, "x");
+
+	s.assign(std::istream_iterator<std::string>(words), std::istream_iterator<std::string>());
+	print_vector("istream assign", s);
+
+	std::list<int>						l(v.begin(), v.end());
+	int									arr[] = { 5, 4, 3, 2, 1 };
+	ft::vector<int>						from_list(l.rbegin(), l.rend());
+
+	from_list.insert(from_list.begin() + 2, arr, arr + 5);
+	print_vector("list construct, pointer insert", from_list);
+	from_list.assign(arr + 1, arr + 4);
+	from_list.insert(from_list.begin() + 1, l.begin(), l.end());
+	print_vector("pointer assign, list insert", from_list);
+}
+
+#if __cplusplus >= 201103L
+// C++11 build: unique_ptr cannot be copied, every path used here has to move.
+void test_move (void)
+{
+	ft::vector<std::unique_ptr<int> >	v;
+
+	for (int i = 0; i < 20; i++)
+		v.push_back(std::unique_ptr<int>(new int(i)));
+	v.emplace_back(new int(100));
+	v.emplace(v.begin() + 3, new int(200));
+	v.insert(v.begin(), std::unique_ptr<int>(new int(300)));
+	v.erase(v.begin() + 5, v.begin() + 8);
+	v.reserve(100);
+	std::cout << "move-only elements (" << v.size() << "):";
+	for (size_t i = 0; i < v.size(); i++)
+		std::cout << " " << *v[i];
+	std::cout << std::endl;
+
+	ft::vector<std::unique_ptr<int> >	moved(std::move(v));
+	ft::vector<std::unique_ptr<int> >	assigned;
+
+	assigned.emplace_back(new int(1));
+	std::cout << "move constructor " << v.size() << " " << moved.size() << " " << *moved.front() << std::endl;
+	assigned = std::move(moved);
+	std::cout << "move assignment " << moved.size() << " " << assigned.size() << " " << *assigned.back() << std::endl;
+
+	ft::vector<std::string>	s;
+	std::string				str(40, 'x');
+
+	s.push_back(std::move(str));
+	s.emplace_back(10, 'y');
+	s.emplace(s.begin(), "first");
+	s.insert(s.begin() + 1, std::string(20, 'z'));
+	for (int i = 0; i < 100; i++)
+		s.emplace_back(i % 10, 'a' + i % 26);
+	std::cout << "moved from string " << str.size() << std::endl;
+	print_vector("emplaced strings", s);
+}
+#endif
 
 int main(int argc, char** argv) {
 	ft::vector<int> vector_int;
@@ -43,5 +390,22 @@ int main(int argc, char** argv) {
     for(int i = 124300; i <= 124310; i++)
      std::cout << copy_vector_int[i] << std::endl;
 
-
-}
\ No newline at end of file
+	test_gap< ft::vector<int> >("int");
+	test_gap< ft::vector<std::string> >("string");
+	test_growth_edges();
+	test_gap< grown<int>::one_and_half >("int one_and_half");
+	test_gap< grown<std::string>::one_and_half >("string one_and_half");
+	test_gap< grown<int>::rounded >("int rounded");
+	test_gap< grown<std::string>::rounded >("string rounded");
+	test_gap< grown<int>::capped >("int capped");
+	test_gap< grown<std::string>::capped >("string capped");
+	test_mapped<int>("int");
+	test_mapped<std::string>("string");
+	test_release();
+	test_default_init();
+	test_iterator_categories();
+#if __cplusplus >= 201103L
+	test_move();
+#endif
+	return (0);
+}
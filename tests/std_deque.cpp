@@ -0,0 +1,98 @@
+#include <iostream>
+#include <string>
+#include <stdlib.h>
+
+#include <deque>
+#include <stack>
+namespace ft = std;
+
+#define BUFFER_SIZE 4096
+struct Buffer
+{
+	int idx;
+	char buff[BUFFER_SIZE];
+};
+
+// std::deque has shrink_to_fit from C++11 and std::stack has none, the elements are
+// unchanged either way.
+void shrink_to_fit(ft::deque<int> & c)
+{
+	ft::deque<int>(c).swap(c);
+}
+
+void shrink_to_fit(ft::stack<Buffer> &)
+{
+}
+
+int main(int argc, char** argv) {
+	(void)argc;
+	(void)argv;
+	ft::deque<int> deque_int;
+	ft::stack<Buffer> stack_buffer;
+
+	srand(123);
+	std::cout << "deque is empty" << std::endl;
+	std::cout << deque_int.empty() << std::endl;
+
+	for (int i = 0; i < 10000000; i++)
+	{
+		if (i % 3)
+			deque_int.push_back(rand());
+		else
+			deque_int.push_front(rand());
+	}
+	for (int i = 0; i < 1000000; i++)
+		deque_int.pop_front();
+
+	std::cout << "deque size" << std::endl;
+	std::cout << deque_int.size() << std::endl;
+
+	std::cout << "deque front/back" << std::endl;
+	std::cout << deque_int.front() << std::endl;
+	std::cout << deque_int.back() << std::endl;
+
+	std::cout << "deque data" << std::endl;
+	for (int i = 124300; i <= 124310; i++)
+		std::cout << deque_int[i] << std::endl;
+
+	deque_int.erase(deque_int.begin() + 10, deque_int.begin() + 20);
+	deque_int.insert(deque_int.end() - 10, 5, 42);
+	for (int i = 0; i <= 20; i++)
+		std::cout << deque_int[i] << " " << *(deque_int.rbegin() + i) << std::endl;
+
+	for (int i = 0; i < 100000; i++)
+	{
+		stack_buffer.push(Buffer());
+		stack_buffer.top().idx = i;
+	}
+	std::cout << "stack size/top" << std::endl;
+	std::cout << stack_buffer.size() << std::endl;
+	std::cout << stack_buffer.top().idx << std::endl;
+
+	for (int i = 0; i < 99000; i++)
+		stack_buffer.pop();
+	shrink_to_fit(stack_buffer);
+	for (int i = 0; i < 500; i++)
+	{
+		stack_buffer.push(Buffer());
+		stack_buffer.top().idx = -i;
+	}
+	std::cout << "stack size/top after shrink_to_fit" << std::endl;
+	std::cout << stack_buffer.size() << std::endl;
+	std::cout << stack_buffer.top().idx << std::endl;
+
+	deque_int.erase(deque_int.begin() + 100, deque_int.end() - 100);
+	shrink_to_fit(deque_int);
+	deque_int.push_front(7);
+	deque_int.push_back(8);
+	std::cout << "deque after shrink_to_fit" << std::endl;
+	std::cout << deque_int.size() << std::endl;
+	for (int i = 95; i <= 106; i++)
+		std::cout << deque_int[i] << std::endl;
+	std::cout << deque_int.front() << " " << deque_int.back() << std::endl;
+	deque_int.clear();
+	shrink_to_fit(deque_int);
+	deque_int.push_back(1);
+	std::cout << deque_int.size() << " " << deque_int.front() << std::endl;
+	return (0);
+}
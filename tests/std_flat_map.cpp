@@ -0,0 +1,72 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <stdlib.h>
+
+#include <map>
+namespace ft = std;
+
+typedef std::map<int, int>						int_map;
+typedef std::map<std::string, std::string>		str_map;
+
+int main(int argc, char** argv) {
+	(void)argc;
+	(void)argv;
+	int_map		map_int;
+	str_map		map_str;
+
+	srand(123);
+	std::cout << "map is empty" << std::endl;
+	std::cout << map_int.empty() << std::endl;
+
+	for (int i = 0; i < 200000; i++)
+		map_int.insert(ft::make_pair(rand() % 1000000, i));
+	for (int i = 0; i < 50000; i++)
+		map_int[rand() % 1000000] = -i;
+	for (int i = 0; i < 50000; i++)
+		map_int.erase(rand() % 1000000);
+
+	std::cout << "map size" << std::endl;
+	std::cout << map_int.size() << std::endl;
+
+	std::cout << "map data" << std::endl;
+	int_map::iterator	it = map_int.begin();
+	for (int i = 0; i < 10; i++, it++)
+		std::cout << it->first << " " << it->second << std::endl;
+	int_map::reverse_iterator	rit = map_int.rbegin();
+	for (int i = 0; i < 10; i++, rit++)
+		std::cout << rit->first << " " << rit->second << std::endl;
+
+	std::cout << "map lookups" << std::endl;
+	long	found = 0;
+	for (int i = 0; i < 1000000; i++)
+		found += map_int.count(rand() % 1000000);
+	std::cout << found << std::endl;
+	for (int k = 0; k < 10; k++)
+	{
+		int		key = rand() % 1000000;
+		int_map::iterator	lb = map_int.lower_bound(key);
+		int_map::iterator	ub = map_int.upper_bound(key);
+		std::cout << key << " " << (lb != map_int.end() ? lb->first : -1) << " " << (ub != map_int.end() ? ub->first : -1)
+			<< " " << (map_int.find(key) != map_int.end()) << std::endl;
+	}
+
+	map_int.erase(map_int.lower_bound(1000), map_int.upper_bound(500000));
+	std::cout << "map size after range erase" << std::endl;
+	std::cout << map_int.size() << std::endl;
+
+	int_map		copy(map_int.begin(), map_int.end());
+	copy[42] = 42;
+	std::cout << "copy compare" << std::endl;
+	std::cout << (copy == map_int) << " " << (map_int < copy) << " " << copy.size() << std::endl;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		std::ostringstream	key;
+		key << "key" << rand() % 500;
+		map_str[key.str()] += "x";
+	}
+	std::cout << "string map" << std::endl;
+	std::cout << map_str.size() << " " << map_str.begin()->first << " " << map_str.begin()->second << std::endl;
+	return (0);
+}
@@ -0,0 +1,469 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <stdlib.h>
+
+#include <map>
+namespace ft = std;
+
+// std::map has no order statistics: the same answers, walking the map.
+template <class Map>
+typename Map::const_iterator select(const Map & m, size_t k)
+{
+	typename Map::const_iterator	it = m.begin();
+
+	for ( ; k > 0 && it != m.end() ; k--)
+		++it;
+	return (it);
+}
+
+template <class Map>
+size_t rank(const Map & m, const typename Map::key_type & k)
+{
+	return (ft::distance(m.begin(), m.lower_bound(k)));
+}
+
+template <class Map>
+size_t count_range(const Map & m, const typename Map::key_type & lo, const typename Map::key_type & hi)
+{
+	if (!(lo < hi))
+		return (0);
+	return (ft::distance(m.lower_bound(lo), m.lower_bound(hi)));
+}
+
+template <class Map>
+size_t index_of(const Map & m, typename Map::const_iterator it)
+{
+	return (ft::distance(m.begin(), it));
+}
+
+// select, rank, count_range and index_of at both ends and in the middle.
+void print_order_statistics(const std::string & title, const ft::map<int, int> & m)
+{
+	typedef ft::map<int, int>::const_iterator	const_iterator;
+
+	size_t	n = m.size();
+	size_t	positions[] = {0, 1, n / 2, n - 1, n, n + 1};
+	int		first = n ? m.begin()->first : 0;
+	int		middle = n ? select(m, n / 2)->first : 0;
+	int		last = n ? (--m.end())->first : 0;
+
+	std::cout << title << std::endl;
+	std::cout << "select";
+	for (int i = 0; i < 6; i++)
+	{
+		const_iterator	it = select(m, positions[i]);
+
+		if (it == m.end())
+			std::cout << " end";
+		else
+			std::cout << " " << it->first;
+	}
+	std::cout << std::endl << "rank";
+	int		keys[] = {first - 1, first, first + 1, middle, middle + 1, last, last + 1};
+	for (int i = 0; i < 7; i++)
+		std::cout << " " << rank(m, keys[i]);
+	std::cout << std::endl << "count_range";
+	std::cout << " " << count_range(m, first, last) << " " << count_range(m, first, last + 1)
+		<< " " << count_range(m, first - 1000, last + 1000) << " " << count_range(m, middle, middle)
+		<< " " << count_range(m, middle, middle + 1) << " " << count_range(m, last, first) << std::endl;
+	std::cout << "index_of " << index_of(m, m.begin()) << " " << index_of(m, m.end());
+	if (n)
+		std::cout << " " << index_of(m, m.find(middle)) << " " << index_of(m, --m.end())
+			<< " " << index_of(m, m.lower_bound(middle + 1));
+	std::cout << std::endl;
+}
+
+// walks m forwards and backwards, the two hashes tell whether every node was reached in order.
+template <class Map>
+void print_walk(const std::string & title, const Map & m)
+{
+	unsigned long	forward = 0;
+	unsigned long	backward = 0;
+	size_t			count = 0;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it, ++count)
+		forward = forward * 31 + it->first;
+	for (typename Map::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+		backward = backward * 31 + it->first;
+	std::cout << title << std::endl;
+	std::cout << m.size() << " " << count << " " << forward << " " << backward << std::endl;
+}
+
+// std::map has no node handles in C++98: the elements are copied instead.
+template <class Map>
+int move_element(Map & src, const typename Map::key_type & k, const typename Map::key_type & new_key, Map & dst, bool hint)
+{
+	typename Map::iterator		it = src.find(k);
+
+	if (it == src.end())
+		return (-1);
+
+	typename Map::mapped_type	value = it->second;
+
+	src.erase(it);
+
+	size_t						size = dst.size();
+
+	if (hint)
+		dst.insert(dst.lower_bound(new_key), ft::make_pair(new_key, value));
+	else
+		dst.insert(ft::make_pair(new_key, value));
+	if (dst.size() != size)
+		return (1);
+	src.insert(ft::make_pair(k, value));
+	return (0);
+}
+
+template <class Map>
+size_t drop_element(Map & src, const typename Map::key_type & k)
+{
+	return (src.erase(k));
+}
+
+template <class Map>
+void merge_maps(Map & dst, Map & src)
+{
+	if (&dst == &src)
+		return ;
+	for (typename Map::iterator it = src.begin(); it != src.end(); )
+	{
+		if (dst.insert(*it).second)
+			src.erase(it++);
+		else
+			++it;
+	}
+}
+
+// std::map has no sorted_unique overloads: the plain range ones give the same result.
+template <class Map, class InputIterator>
+Map build_sorted(InputIterator first, InputIterator last)
+{
+	return (Map(first, last));
+}
+
+template <class Map, class InputIterator>
+void insert_sorted(Map & m, InputIterator first, InputIterator last)
+{
+	m.insert(first, last);
+}
+
+// ft::map over an ft::node_pool, std::map with std::allocator here.
+typedef std::map<int, int>				pool_map;
+typedef std::map<int, std::string>		pool_str_map;
+
+template <class Map>
+void reserve_nodes(Map &, size_t)
+{
+}
+
+// std::map has no node handles in C++98: the element is copied out and back.
+template <class Map>
+int clear_holding(Map & m, const typename Map::key_type & k, int n)
+{
+	typename Map::iterator		it = m.find(k);
+
+	if (it == m.end())
+		return (-1);
+
+	typename Map::value_type	held = *it;
+
+	m.clear();
+	for (int i = 0; i < n; i++)
+		m[i * 2] = typename Map::mapped_type();
+	return (m.insert(held).second);
+}
+
+int main(int argc, char** argv) {
+	(void)argc;
+	(void)argv;
+	ft::map<int, int>				map_int;
+	ft::map<std::string, int>		map_str;
+
+	srand(123);
+	std::cout << "map is empty" << std::endl;
+	std::cout << map_int.empty() << " " << map_int.size() << std::endl;
+
+	for (int i = 0; i < 100000; i++)
+		map_int.insert(ft::make_pair(rand() % 200000, i));
+	std::cout << "map size after insert" << std::endl;
+	std::cout << map_int.size() << std::endl;
+
+	for (int i = 0; i < 20000; i++)
+		map_int[rand() % 200000] = -i;
+	std::cout << "map size after operator[]" << std::endl;
+	std::cout << map_int.size() << std::endl;
+
+	long	erased = 0;
+	for (int i = 0; i < 50000; i++)
+		erased += map_int.erase(rand() % 200000);
+	std::cout << "map size after erase" << std::endl;
+	std::cout << erased << " " << map_int.size() << std::endl;
+	print_order_statistics("order statistics after erase", map_int);
+
+	ft::map<int, int>::iterator		first = map_int.begin();
+	ft::map<int, int>::iterator		last = map_int.begin();
+	for (int i = 0; i < 1000; i++)
+		last++;
+	map_int.erase(first, last);
+	std::cout << "map size after range erase" << std::endl;
+	std::cout << map_int.size() << " " << map_int.begin()->first << std::endl;
+	print_order_statistics("order statistics after range erase", map_int);
+
+	std::cout << "map data" << std::endl;
+	ft::map<int, int>::reverse_iterator	rit = map_int.rbegin();
+	for (int i = 0; i < 10; i++, rit++)
+		std::cout << rit->first << " " << rit->second << std::endl;
+
+	ft::map<int, int>	copy(map_int);
+	ft::map<int, int>	assigned;
+	assigned = map_int;
+	copy.erase(copy.begin());
+	std::cout << "copy and assignment" << std::endl;
+	std::cout << copy.size() << " " << assigned.size() << " " << (assigned == map_int) << " " << (copy == map_int) << std::endl;
+
+	copy.swap(assigned);
+	std::cout << "swap" << std::endl;
+	std::cout << copy.size() << " " << assigned.size() << std::endl;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		std::ostringstream	key;
+		key << "key" << rand() % 500;
+		map_str[key.str()] += i;
+	}
+	std::cout << "string map" << std::endl;
+	std::cout << map_str.size() << " " << map_str.begin()->first << " " << map_str.begin()->second << std::endl;
+
+	map_int.clear();
+	std::cout << "map size after clear" << std::endl;
+	std::cout << map_int.empty() << " " << map_int.size() << std::endl;
+	print_order_statistics("order statistics of an empty map", map_int);
+	map_int[5] = 5;
+	print_order_statistics("order statistics of one element", map_int);
+	for (int i = 0; i < 64; i++)
+		map_int[i * 2] = i;
+	print_order_statistics("order statistics of even keys", map_int);
+
+	// rounds of inserts and erases rebalance the tree over and over: the colors and
+	// links of the nodes are rewritten many times, also when packed by FT_MAP_COMPACT_NODES.
+	ft::map<int, int>	churn;
+	for (int round = 0; round < 20; round++)
+	{
+		for (int i = 0; i < 2000; i++)
+			churn.insert(ft::make_pair(rand() % 5000, round));
+		for (int i = 0; i < 1500; i++)
+			churn.erase(rand() % 5000);
+		if (round % 5 == 4)
+			print_walk("churn", churn);
+	}
+	churn.clear();
+	for (int i = 0; i < 1000; i++)
+		churn[i] = i;
+	for (int i = 3000; i > 2000; i--)
+		churn[i] = i;
+	for (int i = 0; i < 3000; i += 2)
+		churn.erase(i);
+	print_walk("ascending and descending keys", churn);
+	while (churn.size() > 10)
+	{
+		churn.erase(churn.begin());
+		churn.erase(--churn.end());
+	}
+	print_walk("erased from both ends", churn);
+
+	ft::map<char, std::string>	map_char;
+	for (int i = 0; i < 500; i++)
+	{
+		map_char[static_cast<char>(rand() % 94 + 33)] += static_cast<char>('a' + i % 26);
+		if (i % 3 == 0)
+			map_char.erase(static_cast<char>(rand() % 94 + 33));
+	}
+	print_walk("char map", map_char);
+	std::cout << map_char.begin()->first << " " << map_char.begin()->second << std::endl;
+
+	// node handles: elements renamed and moved from one map to another, then merges
+	// leaving the keys both maps hold in the source.
+	ft::map<int, int>	left;
+	ft::map<int, int>	right;
+	ft::map<int, int>	empty;
+	for (int i = 0; i < 200; i++)
+		left[i * 3] = i;
+	for (int i = 0; i < 100; i++)
+		right[i * 5] = -i;
+	std::cout << "node handles" << std::endl;
+	// one move per statement: the operands of a << chain are evaluated in no set order.
+	std::cout << move_element(left, 0, 1, left, false);
+	std::cout << " " << move_element(left, 3, 10, right, false);
+	std::cout << " " << move_element(left, 6, 11, right, true);
+	std::cout << " " << move_element(left, 7, 8, right, false);
+	std::cout << " " << move_element(right, 11, 6, left, false);
+	std::cout << " " << move_element(left, 597, 1000, right, true);
+	std::cout << " " << move_element(left, 9, 9, left, true);
+	std::cout << " " << move_element(left, 12, 15, right, true);
+	std::cout << " " << move_element(empty, 1, 2, left, false) << std::endl;
+	std::cout << drop_element(left, 300);
+	std::cout << " " << drop_element(left, 301);
+	std::cout << " " << drop_element(right, 1000) << std::endl;
+	std::cout << left[1] << " " << left[3] << " " << left[6] << " " << right[10] << " " << right[1000] << std::endl;
+	print_walk("left after moves", left);
+	print_walk("right after moves", right);
+
+	merge_maps(left, left);
+	merge_maps(left, empty);
+	merge_maps(left, right);
+	print_walk("left after merge", left);
+	print_walk("right after merge", right);
+	std::cout << "kept in right:";
+	for (ft::map<int, int>::iterator it = right.begin(); it != right.end(); ++it)
+		std::cout << " " << it->first << "=" << it->second;
+	std::cout << std::endl;
+	merge_maps(empty, left);
+	print_walk("merged into an empty map", empty);
+	std::cout << left.size() << " " << empty.begin()->second << " " << (--empty.end())->first << std::endl;
+
+	// assignments growing and shrinking the destination, to and from an empty map.
+	ft::map<int, int>	small_map;
+	ft::map<int, int>	big_map;
+	ft::map<int, int>	no_map;
+	for (int i = 0; i < 10; i++)
+		small_map[i * 7] = i;
+	for (int i = 0; i < 5000; i++)
+		big_map[rand() % 20000] = i;
+	ft::map<int, int>	target(small_map);
+	std::cout << "assignment" << std::endl;
+	target = big_map;
+	std::cout << (target == big_map) << " ";
+	target = small_map;
+	std::cout << (target == small_map) << " ";
+	target = no_map;
+	std::cout << target.empty() << " ";
+	target = big_map;
+	target = target;
+	std::cout << (target == big_map) << " ";
+	no_map = target;
+	std::cout << (no_map == big_map) << " ";
+	target.erase(target.begin());
+	target[-1] = 1;
+	std::cout << (target == big_map) << " " << big_map.begin()->first << std::endl;
+	print_walk("assigned a bigger map", no_map);
+	print_walk("modified after assignment", target);
+	map_str = ft::map<std::string, int>();
+	std::cout << map_str.size() << std::endl;
+
+	// range construction from sorted and unsorted ranges, and sorted ranges merged into
+	// maps holding keys before, after, between and equal to theirs.
+	ft::pair<int, int>	unsorted[200];
+	ft::pair<int, int>	sorted[100];
+	for (int i = 0; i < 200; i++)
+		unsorted[i] = ft::make_pair(rand() % 150, i);
+	for (int i = 0; i < 100; i++)
+		sorted[i] = ft::make_pair(i * 4 + 100, i);
+	ft::map<int, int>	from_unsorted(unsorted, unsorted + 200);
+	ft::map<int, int>	from_sorted = build_sorted< ft::map<int, int> >(sorted, sorted + 100);
+	ft::map<int, int>	from_map = build_sorted< ft::map<int, int> >(big_map.begin(), big_map.end());
+	ft::map<int, int>	from_nothing = build_sorted< ft::map<int, int> >(sorted, sorted);
+	ft::map<int, int>	from_one = build_sorted< ft::map<int, int> >(sorted + 50, sorted + 51);
+	std::cout << "range construction" << std::endl;
+	std::cout << from_unsorted.size() << " " << from_unsorted[0] << " " << from_sorted.size() << " "
+		<< (from_map == big_map) << " " << from_nothing.size() << " " << from_one.begin()->first << std::endl;
+	print_walk("from an unsorted range", from_unsorted);
+	print_walk("from a sorted range", from_sorted);
+
+	insert_sorted(from_nothing, sorted + 10, sorted + 20);
+	insert_sorted(from_nothing, sorted, sorted + 5);
+	insert_sorted(from_nothing, sorted + 90, sorted + 100);
+	insert_sorted(from_nothing, sorted, sorted);
+	print_walk("sorted inserts before and after", from_nothing);
+	insert_sorted(from_unsorted, sorted, sorted + 100);
+	std::cout << from_unsorted[100] << " " << from_unsorted[104] << " " << from_unsorted[148] << std::endl;
+	print_walk("sorted insert between and on existing keys", from_unsorted);
+	insert_sorted(from_one, sorted, sorted + 100);
+	insert_sorted(from_one, from_map.begin(), from_map.end());
+	std::cout << (from_one.size() == from_map.size()) << " " << from_one[300] << std::endl;
+	print_walk("sorted inserts around one element", from_one);
+
+	// clear and teardown: maps emptied through clear() and erase(begin(), end()), then
+	// reused, and maps of strings going out of scope.
+	ft::map<int, int>	cleared(big_map);
+	ft::map<int, int>::iterator	cleared_end = cleared.end();
+	no_map.clear();
+	cleared.clear();
+	cleared.clear();
+	std::cout << "clear" << std::endl;
+	std::cout << no_map.size() << " " << cleared.size() << " " << (cleared.begin() == cleared.end())
+		<< " " << (cleared.end() == cleared_end) << " " << (cleared.rbegin() == cleared.rend()) << " " << big_map.size() << std::endl;
+	for (int i = 0; i < 3000; i++)
+		cleared[i] = i;
+	print_walk("filled after clear", cleared);
+	print_order_statistics("order statistics after clear", cleared);
+	cleared.erase(cleared.begin(), cleared.end());
+	cleared.insert(ft::make_pair(7, 7));
+	print_walk("erased from begin to end", cleared);
+	for (int round = 0; round < 3; round++)
+	{
+		ft::map<std::string, std::string>	scoped;
+
+		for (int i = 0; i < 1000 * (round + 1); i++)
+		{
+			std::ostringstream	key;
+			key << "teardown" << rand() % 5000;
+			scoped[key.str()] += key.str();
+		}
+		if (round == 1)
+			scoped.clear();
+		std::cout << scoped.size() << " ";
+	}
+	std::cout << std::endl;
+
+	// maps over a node pool: reserve then inserts, clear resetting the pool then refills
+	// reusing its slabs, clear while a copy shares the pool, and node handles held across clear.
+	pool_map	pooled;
+	reserve_nodes(pooled, 5000);
+	for (int i = 0; i < 5000; i++)
+		pooled.insert(ft::make_pair(rand() % 10000, i));
+	print_walk("pool after reserve", pooled);
+	pooled.clear();
+	std::cout << "pool clear " << pooled.size() << " " << (pooled.begin() == pooled.end()) << std::endl;
+	for (int i = 0; i < 8000; i++)
+		pooled[rand() % 20000] = i;
+	print_walk("pool refilled after clear", pooled);
+	pooled.clear();
+	reserve_nodes(pooled, 100);
+	for (int i = 0; i < 300; i++)
+		pooled[i * 3] = i;
+	print_walk("pool refilled after a second clear", pooled);
+	{
+		pool_map	shared(pooled);
+
+		pooled.clear();
+		print_walk("copy sharing the pool, original cleared", shared);
+		for (int i = 0; i < 100; i++)
+			pooled[i] = i;
+		shared.erase(shared.begin());
+		shared[-5] = 5;
+		print_walk("copy after the original refilled", shared);
+		print_walk("original refilled", pooled);
+	}
+	pooled.clear();
+	for (int i = 0; i < 1000; i++)
+		pooled[i * 2 + 1] = i;
+	std::cout << "handles across clear " << clear_holding(pooled, 501, 400);
+	std::cout << " " << clear_holding(pooled, 501, 1000);
+	std::cout << " " << clear_holding(pooled, 400, 300);
+	std::cout << " " << clear_holding(pooled, 7, 10) << " " << pooled[501] << " " << pooled.count(400) << std::endl;
+	print_walk("handles across clear", pooled);
+
+	pool_str_map	pooled_str;
+	for (int i = 0; i < 2000; i++)
+		pooled_str[rand() % 3000] += static_cast<char>('a' + i % 26);
+	pool_str_map	pooled_str_copy(pooled_str);
+	pooled_str.clear();
+	for (int i = 0; i < 500; i++)
+		pooled_str[i] = "refill";
+	std::cout << "string pool " << clear_holding(pooled_str, 11, 50);
+	std::cout << " " << pooled_str[11] << " " << pooled_str[10].empty() << " " << pooled_str_copy.begin()->second << std::endl;
+	print_walk("string pool", pooled_str);
+	print_walk("string pool copy", pooled_str_copy);
+	return (0);
+}
@@ -0,0 +1,81 @@
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <stdlib.h>
+
+#include <stack>
+#include <vector>
+namespace ft = std;
+
+// a stack showing the capacity of its vector. std::stack has no shrink_to_fit: the
+// vector is swapped with a copy.
+template <class T>
+class open_stack : public ft::stack<T, ft::vector<T> >
+{
+public:
+	std::size_t capacity (void) const
+	{
+		return (this->c.capacity());
+	}
+
+	void shrink_to_fit (void)
+	{
+		ft::vector<T>(this->c).swap(this->c);
+	}
+};
+
+int main(int argc, char** argv) {
+	(void)argc;
+	(void)argv;
+	open_stack<int>				stack_int;
+	open_stack<std::string>		stack_str;
+
+	srand(123);
+	std::cout << "stack is empty" << std::endl;
+	std::cout << stack_int.empty() << " " << stack_int.size() << std::endl;
+
+	for (int i = 0; i < 100000; i++)
+		stack_int.push(rand());
+	std::cout << "stack size/top/capacity after push" << std::endl;
+	std::cout << stack_int.size() << " " << stack_int.top() << " " << stack_int.capacity() << std::endl;
+
+	open_stack<int>		copy(stack_int);
+
+	copy.pop();
+	std::cout << "copy and compare" << std::endl;
+	std::cout << (copy == stack_int) << " " << (copy < stack_int) << " " << (copy != stack_int) << " " << (stack_int >= copy) << std::endl;
+
+	long	sum = 0;
+	while (!stack_int.empty())
+	{
+		sum += stack_int.top() % 1000;
+		stack_int.pop();
+	}
+	std::cout << "stack drained" << std::endl;
+	std::cout << sum << " " << stack_int.size() << " " << stack_int.capacity() << std::endl;
+	stack_int.shrink_to_fit();
+	std::cout << "capacity after shrink_to_fit" << std::endl;
+	std::cout << stack_int.capacity() << std::endl;
+	for (int i = 0; i < 10; i++)
+		stack_int.push(i);
+	std::cout << stack_int.size() << " " << stack_int.top() << " " << stack_int.capacity() << std::endl;
+
+	while (copy.size() > 1000)
+		copy.pop();
+	copy.shrink_to_fit();
+	std::cout << "partly drained copy after shrink_to_fit" << std::endl;
+	std::cout << copy.size() << " " << copy.top() << " " << copy.capacity() << std::endl;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		std::ostringstream	str;
+		str << "elem" << i;
+		stack_str.push(str.str());
+	}
+	while (stack_str.size() > 300)
+		stack_str.pop();
+	stack_str.shrink_to_fit();
+	std::cout << "string stack after shrink_to_fit" << std::endl;
+	std::cout << stack_str.size() << " " << stack_str.top() << " " << stack_str.capacity() << std::endl;
+	return (0);
+}
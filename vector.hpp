@@ -7,7 +7,9 @@
 namespace ft
 {
 
-template <class T, class Alloc = std::allocator<T> >
+// Growth is the growth policy deciding the new capacity when the vector is full,
+// see includes/growth_policy.hpp.
+template <class T, class Alloc = std::allocator<T>, class Growth = ft::growth_double>
 class vector {
 public:
 
@@ -22,8 +24,12 @@ public:
 		typedef typename		ft::conditional<IsConst, const T, T>::type			value_type;
 		typedef					std::ptrdiff_t										difference_type;
 		typedef					std::size_t											size_type;
+		typedef					value_type *										pointer;
+		typedef					value_type &										reference;
+		typedef					ft::random_access_iterator_tag						iterator_category;
 		// -structors
 		vectorIterator			(void)												{ _ptr = NULL; }
+		vectorIterator			(const vectorIterator & x)							{ _ptr = x.getPtr(); }
 		~vectorIterator			(void)												{}
 		// Const stuff
 		template <bool B>		vectorIterator
@@ -31,8 +37,8 @@ public:
 
 		// Assignment
 		vectorIterator &		operator=	(const vectorIterator & x)				{ _ptr = x.getPtr(); return (*this); }
-		vectorIterator &		operator+=	(int n)									{ _ptr += n; return (*this); }
-		vectorIterator &		operator-=	(int n)									{ _ptr -= n; return (*this); }
+		vectorIterator &		operator+=	(difference_type n)						{ _ptr += n; return (*this); }
+		vectorIterator &		operator-=	(difference_type n)						{ _ptr -= n; return (*this); }
 		// Comparison
 		template <bool B> bool	operator==	(const vectorIterator<B> & x) const		{ return (_ptr == x.getPtr()); }
 		template <bool B> bool	operator!=	(const vectorIterator<B> & x) const		{ return (_ptr != x.getPtr()); }
@@ -46,17 +52,17 @@ public:
 		vectorIterator			operator++	(int)									{ vectorIterator<IsConst> x(*this); _ptr++; return (x); }
 		vectorIterator			operator--	(int)									{ vectorIterator<IsConst> x(*this); _ptr--; return (x); }
 		// Operation
-		vectorIterator			operator+	(int n) const							{ return (_ptr + n); }
-		vectorIterator			operator-	(int n) const							{ return (_ptr - n); }
+		vectorIterator			operator+	(difference_type n) const				{ return (_ptr + n); }
+		vectorIterator			operator-	(difference_type n) const				{ return (_ptr - n); }
 		difference_type			operator-	(const vectorIterator & x) const		{ return (_ptr - x.getPtr()); }
 		// Dereference
-		value_type &			operator[]	(size_type n) const						{ return (*(_ptr + n)); }
+		value_type &			operator[]	(difference_type n) const				{ return (*(_ptr + n)); }
 		value_type &			operator*	(void) const							{ return (*_ptr); }
 		value_type *			operator->	(void) const							{ return (_ptr); }
 		// Member functions
 		value_type *			getPtr		(void) const							{ return (_ptr); }
 		// Friend functions
-		friend vectorIterator	operator+	(int n, const vectorIterator & x)		{ return (x.getPtr() + n); }
+		friend vectorIterator	operator+	(difference_type n, const vectorIterator & x)	{ return (x.getPtr() + n); }
 		vectorIterator			(value_type * const ptr)							{ _ptr = ptr; }
 
 	private:
@@ -69,6 +75,7 @@ public:
 
 	typedef		T												value_type;			   //The first template parameter (T)
 	typedef		Alloc											allocator_type;		   //The second template parameter (Alloc)
+	typedef		Growth											growth_policy;		   //The third template parameter (Growth)
 	typedef		typename allocator_type::reference				reference;		       //for the default allocator: value_type&
 	typedef		typename allocator_type::const_reference		const_reference;	   //for the default allocator: const value_type&
 	typedef		typename allocator_type::pointer				pointer;			   //for the default allocator: value_type*
@@ -88,7 +95,7 @@ public:
 	explicit vector (const allocator_type & alloc = allocator_type())
 	{
 		_alloc = alloc; 			//	allocator object
-		_vct = _alloc.allocate(0);	//	vector var
+		_vct = NULL;				//	vector var, nothing is allocated until the first element
 		_size = 0;					//	number of current values
 		_capacity = 0;				// 	number of possible values to be held in vector
 	}
@@ -111,17 +118,12 @@ public:
 	vector (InputIterator first, InputIterator last, const allocator_type & alloc = allocator_type(),
 	typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
 	{
-		size_type		n = 0;
-		for (InputIterator cpy = first ; cpy != last && n <= this->max_size() ; cpy++)
-			n++;
-
 		_alloc = alloc;
-		_size = n;
-		_capacity = n;
-		_vct = _alloc.allocate(n);
+		_size = 0;
+		_capacity = 0;
+		_vct = NULL;
 
-		for (size_type i = 0 ; i < n ; i++)
-			_alloc.construct(_vct + i, *first++);
+		this->assign(first, last);
 	}
 
 	//copy constructor: Constructs a container with a copy of each of the elements in x, in the same order.
@@ -132,10 +134,24 @@ public:
 		_capacity = x._size; //weirdly the std::vector doesn't copy capacity size from orgin, it copies origin size in capacity
 		_vct = _alloc.allocate(_capacity); // allocate needed capacity and returns pointer to first space in vector.
 
-		for (size_type i = 0 ; i < _size ; i++)
-			_alloc.construct(_vct + i, x[i]); // constructs element objects 
+		this->_construct_copy(_vct, x._vct, _size); // constructs element objects 
 	}
 
+# ifdef FT_CXX11_
+	//move constructor: Constructs a container that acquires the elements of x, x is left empty.
+	vector (vector && x) noexcept
+	{
+		_alloc = x._alloc;
+		_size = x._size;
+		_capacity = x._capacity;
+		_vct = x._vct;
+
+		x._size = 0;
+		x._capacity = 0;
+		x._vct = NULL;
+	}
+# endif
+
 	/////////////////
 	// Destructors //
 	/////////////////
@@ -145,8 +161,7 @@ public:
 
 	~vector (void)
 	{
-		for (size_type i = 0 ; i < _size ; i++)
-			_alloc.destroy(_vct + i); // destroy all values but doesn't deallocate
+		this->_destroy(_vct, _size); // destroy all values but doesn't deallocate
 		_alloc.deallocate(_vct, _capacity); // deallocate space taken by vector
 	}
 
@@ -161,8 +176,7 @@ public:
 		if (this == &x)
 			return (*this);
 
-		for (size_type i = 0 ; i < _size ; i++)
-			_alloc.destroy(_vct + i);
+		this->_destroy(_vct, _size);
 
 		if (x._size > _capacity)
 		{
@@ -172,11 +186,32 @@ public:
 		}
 
 		_size = x._size;
-		for (size_type i = 0 ; i < _size ; i++)
-			_alloc.construct(_vct + i, x[i]);
+		this->_construct_copy(_vct, x._vct, _size);
+
+		return (*this);
+	}
+
+# ifdef FT_CXX11_
+	//Moves the elements of x into the container, the previous content is destroyed and x is left empty.
+	vector & operator= (vector && x) noexcept
+	{
+		if (this == &x)
+			return (*this);
+
+		this->_destroy(_vct, _size);
+		_alloc.deallocate(_vct, _capacity);
+
+		_alloc = x._alloc;
+		_size = x._size;
+		_capacity = x._capacity;
+		_vct = x._vct;
 
+		x._size = 0;
+		x._capacity = 0;
+		x._vct = NULL;
 		return (*this);
 	}
+# endif
 
 	///////////////
 	// Iterators //
@@ -214,12 +249,12 @@ public:
 	// Returns a reverse iterator pointing to the last element in the vector (i.e., its reverse beginning).
 	reverse_iterator rbegin (void)
 	{
-		return (reverse_iterator(_vct + _size - 1));
+		return (reverse_iterator(this->end()));
 	}
 
 	const_reverse_iterator rbegin (void) const
 	{
-		return (const_reverse_iterator(_vct + _size - 1));
+		return (const_reverse_iterator(this->end()));
 	}
 
 	//Return reverse iterator to reverse end
@@ -227,12 +262,12 @@ public:
 	// the first element in the vector (which is considered its reverse end).
 	reverse_iterator rend (void)
 	{
-		return (reverse_iterator(_vct - 1));
+		return (reverse_iterator(this->begin()));
 	}
 
 	const_reverse_iterator rend (void) const
 	{
-		return (const_reverse_iterator(_vct - 1));
+		return (const_reverse_iterator(this->begin()));
 	}
 
 	//////////////
@@ -260,25 +295,41 @@ public:
 		if (n > _size)
 		{
 			if (n > _capacity)
-			{
-				if (n > SIZE_OR_CAP_ * 2)
-					this->reserve(n);
-				else if (SIZE_OR_CAP_ > 0)
-					this->reserve(SIZE_OR_CAP_ * 2);
-				else
-					this->reserve(1);
-			}
+				this->reserve(this->_grow_capacity(n));
 
 			for (size_type i = _size ; i < n ; i++)
 				_alloc.construct(_vct + i, val);
 		}
 		else
-		{
-			for (size_type i = n ; i < _size ; i++)
-				_alloc.destroy(_vct + i);
-		}
+			this->_destroy(_vct + n, _size - n);
 
 		_size = n;
+		this->_auto_release();
+	}
+
+	//Change size without initializing
+	// Same as resize but the new elements are default-initialized: for trivially default
+	// constructible types their memory is not touched, the caller is expected to write them.
+	void resize_default_init (size_type n)
+	{
+		if (n > _size)
+			this->append_uninitialized(n - _size);
+		else
+			this->resize(n);
+	}
+
+	//Append without initializing
+	// Adds n default-initialized elements at the end and returns a pointer to the first one,
+	// for a producer (decoder, read()) to fill them in place.
+	value_type * append_uninitialized (size_type n)
+	{
+		size_type		off = _size;
+
+		if (_size + n > _capacity)
+			this->reserve(this->_grow_capacity(_size + n));
+		this->_default_init(_vct + off, n, ft::is_trivially_default_constructible<T>());
+		_size += n;
+		return (_vct + off);
 	}
 
 	//Return size of allocated storage capacity
@@ -305,19 +356,15 @@ public:
 		}
 
 		if (n > _capacity)
-		{
-			T *		new_vct = _alloc.allocate(n);
-
-			for (size_type i = 0 ; i < _size && i < n ; i++)
-			{
-				_alloc.construct(new_vct + i, _vct[i]);
-				_alloc.destroy(_vct + i);
-			}
-			_alloc.deallocate(_vct, _capacity);
+			this->_reallocate(n);
+	}
 
-			_capacity = n;
-			_vct = new_vct;
-		}
+	//Shrink to fit
+	// Reduces the capacity to the size, the storage left unused is given back to the allocator.
+	void shrink_to_fit (void)
+	{
+		if (_capacity > _size)
+			this->_reallocate(_size);
 	}
 
 	///////////////////
@@ -382,6 +429,17 @@ public:
 		return (_vct[_size - 1]);
 	}
 
+	//	Access data
+	//	Returns a pointer to the array the elements are stored in, [data(), data() + size()) is always a valid range.
+	value_type * data (void)
+	{
+		return (_vct);
+	}
+
+	const value_type * data (void) const
+	{
+		return (_vct);
+	}
 	//////////////////////////
 	// Assignment modifiers //
 	//////////////////////////
@@ -395,34 +453,50 @@ public:
 	void assign (InputIterator first, InputIterator last,
 	typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
 	{
-		size_type		n = 0;
-		for (InputIterator cpy = first ; cpy != last && n < 1000000 ; cpy++)
-			n++;
+		this->_assign_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+	}
 
-		if (n > _capacity)
-			this->reserve(n);
+	//	the new contents are n elements, each initialized to a copy of val.
+	void assign (size_type n, const value_type & val)
+	{
+		value_type		tmp(val); // val may be one of our own elements
 
-		for (size_type i = 0 ; i < _size ; i++)
-			_alloc.destroy(_vct + i);
+		this->_destroy(_vct, _size);
+		_size = 0;
+		if (n > _capacity)
+			this->_reallocate_empty(n);
 		for (size_type i = 0 ; i < n ; i++)
-			_alloc.construct(_vct + i, *first++);
+			_alloc.construct(_vct + i, tmp);
 
 		_size = n;
 	}
 
-	//	the new contents are n elements, each initialized to a copy of val.
-	void assign (size_type n, const value_type & val)
+private:
+	// single pass input iterators can only be read once: the elements are appended as they come.
+	template <class InputIterator>
+	void _assign_range (InputIterator first, InputIterator last, ft::input_iterator_tag)
 	{
-		if (n > _capacity)
-			this->reserve(n);
+		this->clear();
+		for ( ; first != last ; ++first)
+			this->push_back(*first);
+	}
 
-		for (size_type i = 0 ; i < _size ; i++)
-			_alloc.destroy(_vct + i);
-		for (size_type i = 0 ; i < n ; i++)
-			_alloc.construct(_vct + i, val);
+	// forward iterators are counted first (O(1) for random access) and constructed in one go.
+	template <class ForwardIterator>
+	void _assign_range (ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+	{
+		size_type		n = ft::distance(first, last);
+
+		this->_destroy(_vct, _size);
+		_size = 0;
+		if (n > _capacity)
+			this->_reallocate_empty(n);
+		for (size_type i = 0 ; i < n ; i++, ++first)
+			_alloc.construct(_vct + i, *first);
 
 		_size = n;
 	}
+public:
 
 	/////////////////////////
 	// Insertion modifiers //
@@ -437,59 +511,124 @@ public:
 		return (iterator(_vct + off));
 	}
 
+# ifdef FT_CXX11_
+	//	inserts val before position, moving it into the container.
+	iterator insert (iterator position, value_type && val)
+	{
+		return (this->emplace(position, std::move(val)));
+	}
+
+	//	Construct and insert element
+	//	The container is extended by inserting a new element at position, constructed in place using args.
+	template <class... Args>
+	iterator emplace (const_iterator position, Args &&... args)
+	{
+		size_type		off = position - this->begin();
+		value_type		tmp(std::forward<Args>(args)...);
+
+		this->_make_gap(off, 1);
+		_alloc.construct(_vct + off, std::move(tmp));
+		_size++;
+		return (iterator(_vct + off));
+	}
+# endif
+
 	//	inserts count copies of the value before position
 	void insert (iterator position, size_type n, const value_type & val)
 	{
 		size_type		off = position - this->begin();
 
-		if (_size + n > _capacity)
-		{
-			if (_size + n > SIZE_OR_CAP_ * 2)
-				this->reserve(_size + n);
-			else if (SIZE_OR_CAP_ > 0)
-				this->reserve(SIZE_OR_CAP_ * 2);
-			else
-				this->reserve(1);
-		}
+		if (n == 0)
+			return ;
+
+		value_type		tmp(val); // val may be one of the elements being shifted
 
+		this->_make_gap(off, n);
 		for (size_type i = 0 ; i < n ; i++)
-			_alloc.construct(_vct + _size + i, val);
-		for (int i = _size - 1 ; i >= 0 && i >= (int)off ; i--)
-			_vct[i + n] = _vct[i];
-		for (size_type i = off ; i < off + n ; i++)
-			_vct[i] = val;
-		_size = _size + n;
+			_alloc.construct(_vct + off + i, tmp);
+		_size += n;
 	}
 
 	//	inserts elements from range [first, last) before pos.
 	template <class InputIterator>
 	void insert (iterator position, InputIterator first, InputIterator last,
 	typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
+	{
+		this->_insert_range(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+	}
+
+private:
+	// single pass input iterators: read once into a temporary vector, or appended in place at the end.
+	template <class InputIterator>
+	void _insert_range (iterator position, InputIterator first, InputIterator last, ft::input_iterator_tag)
+	{
+		if (position == this->end())
+		{
+			for ( ; first != last ; ++first)
+				this->push_back(*first);
+			return ;
+		}
+
+		vector		tmp;
+
+		for ( ; first != last ; ++first)
+			tmp.push_back(*first);
+		this->insert(position, tmp.begin(), tmp.end());
+	}
+
+	// forward iterators: counted first (O(1) for random access), then built into the gap.
+	template <class ForwardIterator>
+	void _insert_range (iterator position, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
 	{
 		size_type		off = position - this->begin();
-		size_type		n = 0;
-		for (InputIterator cpy = first ; cpy != last && n <= this->max_size() ; cpy++)
-			n++;
+		size_type		n = ft::distance(first, last);
 
-		if (_size + n > _capacity)
+		if (n == 0)
+			return ;
+		if (this->_in_storage(first))
 		{
-			if (_size + n > SIZE_OR_CAP_ * 2)
-				this->reserve(_size + n);
-			else if (SIZE_OR_CAP_ > 0)
-				this->reserve(SIZE_OR_CAP_ * 2);
-			else
-				this->reserve(1);
+			// the gap would move or free the source: it is copied out first.
+			vector		tmp(first, last);
+
+			this->insert(this->begin() + off, tmp.begin(), tmp.end());
+			return ;
 		}
 
-		for (size_type i = 0 ; i < n ; i++)
-			_alloc.construct(_vct + _size + i, *first);
-		for (int i = _size - 1 ; i >= 0 && i >= (int)off ; i--)
-			_vct[i + n] = _vct[i];
-		for (size_type i = off ; i < off + n ; i++)
-			_vct[i] = *first++;
-		_size = _size + n;
+		this->_make_gap(off, n);
+		for (size_type i = 0 ; i < n ; i++, ++first)
+			_alloc.construct(_vct + off + i, *first);
+		_size += n;
 	}
 
+	// whether an iterator points into the elements of this vector, as in v.insert(pos, v.begin(), v.end()).
+	// only our own iterators and pointers can: any other iterator type cannot alias the storage.
+	template <class Iterator>
+	bool _in_storage (const Iterator &) const
+	{
+		return (false);
+	}
+
+	bool _in_storage (const value_type * ptr) const
+	{
+		return (ptr >= _vct && ptr < _vct + _size);
+	}
+
+	bool _in_storage (value_type * ptr) const
+	{
+		return (this->_in_storage(const_cast<const value_type *>(ptr)));
+	}
+
+	bool _in_storage (const iterator & it) const
+	{
+		return (this->_in_storage(it.getPtr()));
+	}
+
+	bool _in_storage (const const_iterator & it) const
+	{
+		return (this->_in_storage(it.getPtr()));
+	}
+public:
+
 	///////////////////////
 	// Erasure modifiers //
 	///////////////////////
@@ -497,24 +636,24 @@ public:
 	//	Removes from the vector either a single element (position) or a range of elements ([first,last)).
 	iterator erase (iterator position)
 	{
-		for (size_type i = position - this->begin() ; i < _size - 1 ; i++)
-			_vct[i] = _vct[i + 1];
-
-		_size--;
-		_alloc.destroy(_vct + _size);
-
-		return (position);
+		return (this->erase(position, position + 1));
 	}
 
 	//	Iterators specifying a range within the vector] to be removed: [first,last).
+	//	the tail after last is shifted down once, whatever the size of the range.
 	iterator erase (iterator first, iterator last)
 	{
+		size_type		off = first - this->begin();
 		size_type		n = last - first;
 
-		while (n-- > 0)
-			this->erase(first);
+		if (n == 0) // nothing to shift, and moving an element onto itself may empty it
+			return (first);
+		this->_move_range(_vct + off, _vct + off + n, _size - off - n);
+		this->_destroy(_vct + _size - n, n);
+		_size -= n;
+		this->_auto_release();
 
-		return (first);
+		return (iterator(_vct + off));
 	}
 
 	//////////////////////
@@ -527,15 +666,40 @@ public:
 	{
 		if (_size + 1 > _capacity)
 		{
-			if (SIZE_OR_CAP_ > 0)
-				this->reserve(SIZE_OR_CAP_ * 2);
-			else
-				this->reserve(1);
+			value_type		tmp(val); // val may live in the storage being released
+
+			this->reserve(this->_grow_capacity(_size + 1));
+			_alloc.construct(_vct + _size, tmp);
 		}
+		else
+			_alloc.construct(_vct + _size, val);
+		_size++;
+	}
 
-		_alloc.construct(_vct + _size, val);
+# ifdef FT_CXX11_
+	//	val is moved into the new element.
+	void push_back (value_type && val)
+	{
+		this->emplace_back(std::move(val));
+	}
+
+	//	Construct and insert element at the end
+	//	Inserts a new element at the end of the vector, constructed in place using args as the arguments for its constructor.
+	template <class... Args>
+	void emplace_back (Args &&... args)
+	{
+		if (_size + 1 > _capacity)
+		{
+			value_type		tmp(std::forward<Args>(args)...);
+
+			this->reserve(this->_grow_capacity(_size + 1));
+			_alloc.construct(_vct + _size, std::move(tmp));
+		}
+		else
+			_alloc.construct(_vct + _size, std::forward<Args>(args)...);
 		_size++;
 	}
+# endif
 
 	//Delete last element
 	//	Removes the last element in the vector, effectively reducing the container size by one.
@@ -545,6 +709,7 @@ public:
 		{
 			_alloc.destroy(_vct + _size - 1);
 			_size--;
+			this->_auto_release();
 		}
 	}
 
@@ -561,9 +726,9 @@ public:
 	//	Removes all elements from the vector (which are destroyed), leaving the container with a size of 0.
 	void clear (void)
 	{
-		for (size_type i = 0 ; i < _size ; i++)
-			_alloc.destroy(_vct + i);
+		this->_destroy(_vct, _size);
 		_size = 0;
+		this->_auto_release();
 	}
 
 	///////////////
@@ -576,11 +741,221 @@ public:
 		return (allocator_type());
 	}
 
+	///////////////////////
+	// Private functions //
+	///////////////////////
+	// protected rather than private: small_vector manages its inline storage with them.
+protected:
+	// element handling is dispatched on ft::is_trivially_copyable<T>: trivially copyable
+	// elements are copied and relocated as raw bytes with a single memcpy/memmove,
+	// any other type goes through the allocator one element at a time.
+
+	// capacity to allocate when the vector has to hold needed elements, as given by the growth policy.
+	size_type _grow_capacity (size_type needed) const
+	{
+		size_type		cap = Growth::template grow<Alloc>(_size, needed);
+
+		if (cap < needed || cap > this->max_size())
+			cap = (needed > this->max_size()) ? needed : this->max_size();
+		return (cap);
+	}
+
+	// shrink the storage when the growth policy asks for it after elements were removed.
+	void _auto_release (void)
+	{
+		size_type		cap = Growth::template release<Alloc>(_size, _capacity);
+
+		if (cap < _capacity && cap >= _size)
+			this->_reallocate(cap);
+	}
+
+	// elements are grown with the allocator's reallocate() when it has one (ft::can_reallocate)
+	// and they can be moved as raw bytes.
+	typedef ft::integral_constant<bool, ft::can_reallocate<Alloc>::value
+		&& ft::is_trivially_copyable<T>::value>							_in_place_reallocation;
+
+	// move the elements to a storage of n elements.
+	void _reallocate (size_type n)
+	{
+		this->_reallocate(n, _in_place_reallocation());
+	}
+
+	void _reallocate (size_type n, ft::true_type)
+	{
+		_vct = _alloc.reallocate(_vct, _capacity, n);
+		_capacity = n;
+	}
+
+	void _reallocate (size_type n, ft::false_type)
+	{
+		value_type *	new_vct = _alloc.allocate(n);
+
+		this->_relocate(new_vct, _vct, _size);
+		_alloc.deallocate(_vct, _capacity);
+
+		_capacity = n;
+		_vct = new_vct;
+	}
+
+	// replace the storage of an empty vector by a fresh one of n elements, nothing is relocated.
+	void _reallocate_empty (size_type n)
+	{
+		if (n > _alloc.max_size())
+			throw std::length_error("vector::_reallocate_empty");
+
+		_alloc.deallocate(_vct, _capacity);
+		_vct = _alloc.allocate(n);
+		_capacity = n;
+	}
+
+	// make room for n elements at off in a single pass: the tail [off, _size) is shifted to
+	// off + n and [off, off + n) is left uninitialized for the caller to construct into.
+	// when the capacity is too small the prefix and the tail are relocated straight into
+	// their final place in the new storage. _size is left for the caller to update.
+	void _make_gap (size_type off, size_type n)
+	{
+		if (_size + n > _capacity)
+		{
+			size_type		new_cap = this->_grow_capacity(_size + n);
+
+			if (new_cap > _alloc.max_size())
+				throw std::length_error("vector::_make_gap");
+
+			if (_in_place_reallocation::value)
+			{
+				this->_reallocate(new_cap);
+				this->_open_gap(off, n, ft::true_type());
+				return ;
+			}
+
+			value_type *	new_vct = _alloc.allocate(new_cap);
+
+			this->_relocate(new_vct, _vct, off);
+			this->_relocate(new_vct + off + n, _vct + off, _size - off);
+			_alloc.deallocate(_vct, _capacity);
+			_vct = new_vct;
+			_capacity = new_cap;
+		}
+		else
+			this->_open_gap(off, n, ft::is_trivially_copyable<T>());
+	}
+
+	void _open_gap (size_type off, size_type n, ft::true_type)
+	{
+		this->_move_range(_vct + off + n, _vct + off, _size - off, ft::true_type());
+	}
+
+	void _open_gap (size_type off, size_type n, ft::false_type)
+	{
+		size_type		split = (_size - off > n) ? _size - n : off;
+
+		// elements landing past _size are constructed, the others are assigned
+		for (size_type i = _size ; i > split ; i--)
+			_alloc.construct(_vct + i - 1 + n, FT_MOVE_(_vct[i - 1]));
+		this->_move_range(_vct + off + n, _vct + off, split - off, ft::false_type());
+		this->_destroy(_vct + off, (n < _size - off) ? n : _size - off, ft::false_type());
+	}
+
+	// copy construct n elements from src into the uninitialized storage at dst.
+	void _construct_copy (value_type * dst, const value_type * src, size_type n)
+	{
+		this->_construct_copy(dst, src, n, ft::is_trivially_copyable<T>());
+	}
+
+	void _construct_copy (value_type * dst, const value_type * src, size_type n, ft::true_type)
+	{
+		if (n)
+			std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(value_type));
+	}
+
+	void _construct_copy (value_type * dst, const value_type * src, size_type n, ft::false_type)
+	{
+		for (size_type i = 0 ; i < n ; i++)
+			_alloc.construct(dst + i, src[i]);
+	}
+
+	// move n elements from src into the uninitialized storage at dst, src is left destroyed.
+	void _relocate (value_type * dst, value_type * src, size_type n)
+	{
+		this->_relocate(dst, src, n, ft::is_trivially_copyable<T>());
+	}
+
+	void _relocate (value_type * dst, value_type * src, size_type n, ft::true_type)
+	{
+		this->_construct_copy(dst, src, n, ft::true_type());
+	}
+
+	void _relocate (value_type * dst, value_type * src, size_type n, ft::false_type)
+	{
+		for (size_type i = 0 ; i < n ; i++)
+		{
+# ifdef FT_CXX11_
+			_alloc.construct(dst + i, std::move_if_noexcept(src[i]));
+# else
+			_alloc.construct(dst + i, src[i]);
+# endif
+			_alloc.destroy(src + i);
+		}
+	}
+
+	// assign the n constructed elements at src onto the constructed elements at dst,
+	// the two ranges may overlap in both directions.
+	void _move_range (value_type * dst, value_type * src, size_type n)
+	{
+		this->_move_range(dst, src, n, ft::is_trivially_copyable<T>());
+	}
+
+	void _move_range (value_type * dst, value_type * src, size_type n, ft::true_type)
+	{
+		if (n && dst != src)
+			std::memmove(static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(value_type));
+	}
+
+	void _move_range (value_type * dst, value_type * src, size_type n, ft::false_type)
+	{
+		if (dst < src)
+		{
+			for (size_type i = 0 ; i < n ; i++)
+				dst[i] = FT_MOVE_(src[i]);
+		}
+		else if (dst > src)
+		{
+			for (size_type i = n ; i > 0 ; i--)
+				dst[i - 1] = FT_MOVE_(src[i - 1]);
+		}
+	}
+
+	// default-initialize n elements at first: nothing to do for trivially default constructible types.
+	void _default_init (value_type *, size_type, ft::true_type)
+	{
+	}
+
+	void _default_init (value_type * first, size_type n, ft::false_type)
+	{
+		for (size_type i = 0 ; i < n ; i++)
+			_alloc.construct(first + i, value_type());
+	}
+
+	// destroy n elements starting at first, trivially copyable types have nothing to destroy.
+	void _destroy (value_type * first, size_type n)
+	{
+		this->_destroy(first, n, ft::is_trivially_copyable<T>());
+	}
+
+	void _destroy (value_type *, size_type, ft::true_type)
+	{
+	}
+
+	void _destroy (value_type * first, size_type n, ft::false_type)
+	{
+		for (size_type i = 0 ; i < n ; i++)
+			_alloc.destroy(first + i);
+	}
+
 	//////////////////////
 	// Member variables //
 	//////////////////////
 
-private:
 	allocator_type		_alloc;
 	size_type			_size;
 	size_type			_capacity;
@@ -595,8 +970,8 @@ private:
 
 	// The equality comparison (operator==) is performed by first comparing sizes, and if they match, 
 	//	the elements are compared sequentially using operator==, stopping at the first mismatch (as if using algorithm equal).
-	template <class T, class Alloc>
-	bool operator== (const vector<T,Alloc> & lhs, const vector<T,Alloc> & rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator== (const vector<T,Alloc,Growth> & lhs, const vector<T,Alloc,Growth> & rhs)
 	{
 		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 	}
@@ -604,32 +979,32 @@ private:
 	//	The less-than comparison (operator<) behaves as if using algorithm lexicographical_compare,
 	// which compares the elements sequentially using operator< in a reciprocal manner (i.e., checking both a<b and b<a) 
 	//	and stopping at the first occurrence.
-	template <class T, class Alloc>
-	bool operator< (const vector<T,Alloc> & lhs, const vector<T,Alloc> & rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator< (const vector<T,Alloc,Growth> & lhs, const vector<T,Alloc,Growth> & rhs)
 	{
 		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 	}
 
-	template <class T, class Alloc>
-	bool operator!= (const vector<T,Alloc> & lhs, const vector<T,Alloc> & rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator!= (const vector<T,Alloc,Growth> & lhs, const vector<T,Alloc,Growth> & rhs)
 	{
 		return (!(lhs == rhs));
 	}
 
-	template <class T, class Alloc>
-	bool operator<= (const vector<T,Alloc> & lhs, const vector<T,Alloc> & rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator<= (const vector<T,Alloc,Growth> & lhs, const vector<T,Alloc,Growth> & rhs)
 	{
 		return (!(rhs < lhs));
 	}
 
-	template <class T, class Alloc>
-	bool operator> (const vector<T,Alloc> & lhs, const vector<T,Alloc> & rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator> (const vector<T,Alloc,Growth> & lhs, const vector<T,Alloc,Growth> & rhs)
 	{
 		return (rhs < lhs);
 	}
 
-	template <class T, class Alloc>
-	bool operator>= (const vector<T,Alloc> & lhs, const vector<T,Alloc> & rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator>= (const vector<T,Alloc,Growth> & lhs, const vector<T,Alloc,Growth> & rhs)
 	{
 		return (!(lhs < rhs));
 	}
@@ -638,8 +1013,8 @@ private:
 	//	Exchange contents of vectors
 	//	The contents of container x are exchanged with those of y. Both container objects must be of 
 	//	the same type (same template parameters), although sizes may differ.
-	template <class T, class Alloc>
-	void swap (vector<T,Alloc> & x, vector<T,Alloc> & y)
+	template <class T, class Alloc, class Growth>
+	void swap (vector<T,Alloc,Growth> & x, vector<T,Alloc,Growth> & y)
 	{
 		x.swap(y);
 	}